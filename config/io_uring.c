@@ -0,0 +1,24 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/* the asynchronous engine uses raw io_uring system calls */
+/* IORING_ENTER_EXT_ARG is the newest thing it needs (Linux 5.11) */
+int test_io_uring() {
+    struct io_uring_params params = { 0 };
+    struct io_uring_getevents_arg arg = { 0 };
+    int fd = syscall(__NR_io_uring_setup, 1, &params);
+
+    if (fd < 0) {
+        return 1;
+    }
+
+    syscall(__NR_io_uring_enter, fd, 0, 0, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+
+    return IORING_OP_SENDMSG == IORING_OP_RECVMSG;
+}
+
+int main(int argc, char **argv) {
+    return test_io_uring();
+}
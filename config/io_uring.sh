@@ -0,0 +1,14 @@
+#!/bin/sh
+
+# io_uring is optional, without it the asynchronous engine only uses epoll
+echo "Finding io_uring headers:"
+if `gcc io_uring.c 2> /dev/null`
+then
+    echo "ok"
+    echo "-DHAVE_IO_URING" > io_uring.cflags
+    # remove the dummy output
+    rm a.out
+else
+    echo "not found, disabling io_uring"
+    > io_uring.cflags
+fi
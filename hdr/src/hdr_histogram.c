@@ -526,6 +526,124 @@ int64_t hdr_value_at_percentile(const struct hdr_histogram* h, double percentile
     return 0;
 }
 
+// Counts are added up this many at a time to skip ahead to the next
+// percentile, the compiler can vectorise the inner loop.
+#define PERCENTILE_BLOCK 16
+
+static int value_at_percentiles(
+    const struct hdr_histogram* h, const double* percentiles, int64_t* values,
+    size_t length, double* mean)
+{
+    size_t at;
+    int32_t i = 0;
+    int32_t j;
+    int32_t limit;
+    int64_t total = 0;
+    int64_t sum = 0;
+    int64_t block;
+    int64_t count;
+    int64_t value;
+
+    if (length > 0 && (NULL == percentiles || NULL == values))
+    {
+        return EINVAL;
+    }
+
+    // Use the values array to hold the count at each percentile until the
+    // value is found.
+    for (at = 0; at < length; at++)
+    {
+        if (at > 0 && percentiles[at] < percentiles[at - 1])
+        {
+            return EINVAL;
+        }
+
+        double requested_percentile = percentiles[at] < 100.0 ? percentiles[at] : 100.0;
+        int64_t count_at_percentile =
+            (int64_t) (((requested_percentile / 100) * h->total_count) + 0.5);
+        values[at] = count_at_percentile > 1 ? count_at_percentile : 1;
+    }
+
+    // Nothing is recorded above the max so the scan can stop there.
+    limit = h->total_count ? counts_index_for(h, h->max_value) + 1 : 0;
+    at = 0;
+
+    while (i < limit && (at < length || NULL != mean))
+    {
+        // Without the mean only the counts around each percentile matter.
+        if (NULL == mean && 0 == h->normalizing_index_offset)
+        {
+            while (i + PERCENTILE_BLOCK <= limit)
+            {
+                block = 0;
+                for (j = 0; j < PERCENTILE_BLOCK; j++)
+                {
+                    block += h->counts[i + j];
+                }
+
+                if (total + block >= values[at])
+                {
+                    break;
+                }
+
+                total += block;
+                i += PERCENTILE_BLOCK;
+            }
+        }
+
+        count = counts_get_normalised(h, i);
+        if (0 != count)
+        {
+            total += count;
+            value = hdr_value_at_index(h, i);
+
+            if (NULL != mean)
+            {
+                sum += count * hdr_median_equivalent_value(h, value);
+            }
+
+            while (at < length && total >= values[at])
+            {
+                values[at] = highest_equivalent_value(h, value);
+                at++;
+            }
+        }
+
+        i++;
+    }
+
+    // Same as hdr_value_at_percentile() for an empty histogram.
+    for (; at < length; at++)
+    {
+        values[at] = 0;
+    }
+
+    if (NULL != mean)
+    {
+        *mean = (sum * 1.0) / h->total_count;
+    }
+
+    return 0;
+}
+
+int hdr_value_at_percentiles(
+    const struct hdr_histogram* h, const double* percentiles, int64_t* values, size_t length)
+{
+    return value_at_percentiles(h, percentiles, values, length, NULL);
+}
+
+int hdr_value_at_percentiles_and_mean(
+    const struct hdr_histogram* h, const double* percentiles, int64_t* values,
+    size_t length, double* mean)
+{
+    if (NULL == mean)
+    {
+        return EINVAL;
+    }
+
+    return value_at_percentiles(h, percentiles, values, length, mean);
+}
+
 double hdr_mean(const struct hdr_histogram* h)
 {
     struct hdr_iter iter;
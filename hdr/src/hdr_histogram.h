@@ -196,6 +196,34 @@ int64_t hdr_max(const struct hdr_histogram* h);
  */
 int64_t hdr_value_at_percentile(const struct hdr_histogram* h, double percentile);
 
+/**
+ * Get the values at several percentiles with a single pass over the counts.
+ * Gives the same results as calling hdr_value_at_percentile() for each one.
+ *
+ * @param h "This" pointer.
+ * @param percentiles The percentiles to get the values for, in increasing order
+ * @param values Array to fill in with the value at each percentile
+ * @param length Number of percentiles
+ * @return 0 on success, EINVAL if the arrays are NULL or the percentiles aren't in order
+ */
+int hdr_value_at_percentiles(
+    const struct hdr_histogram* h, const double* percentiles, int64_t* values, size_t length);
+
+/**
+ * Same as hdr_value_at_percentiles() but also gets the mean in the same pass,
+ * which means reading every count instead of stopping at the last percentile.
+ *
+ * @param h "This" pointer.
+ * @param percentiles The percentiles to get the values for, in increasing order
+ * @param values Array to fill in with the value at each percentile
+ * @param length Number of percentiles, can be 0 to just get the mean
+ * @param mean Set to the mean, the same as hdr_mean()
+ * @return 0 on success, EINVAL if the arrays are NULL or the percentiles aren't in order
+ */
+int hdr_value_at_percentiles_and_mean(
+    const struct hdr_histogram* h, const double* percentiles, int64_t* values,
+    size_t length, double* mean);
+
 /**
  * Gets the standard deviation for the values in the histogram.
  *
@@ -734,7 +734,7 @@ int hdr_log_writer_init(struct hdr_log_writer* writer)
     return 0;
 }
 
-#define LOG_VERSION "1.2"
+#define LOG_VERSION "1.3"
 #define LOG_MAJOR_VERSION 1
 
 static int print_user_prefix(FILE* f, const char* prefix)
@@ -777,7 +777,7 @@ static int print_time(FILE* f, hdr_timespec* timestamp)
 
 static int print_header(FILE* f)
 {
-    return fprintf(f, "\"StartTimestamp\",\"EndTimestamp\",\"Interval_Max\",\"Interval_Compressed_Histogram\"\n");
+    return fprintf(f, "\"StartTimestamp\",\"Interval_Length\",\"Interval_Max\",\"Interval_Compressed_Histogram\"\n");
 }
 
 // Example log
@@ -817,6 +817,22 @@ int hdr_log_write(
     const hdr_timespec* start_timestamp,
     const hdr_timespec* end_timestamp,
     struct hdr_histogram* histogram)
+{
+    struct hdr_log_entry entry;
+
+    entry.start_timestamp = *start_timestamp;
+    entry.interval = *end_timestamp;
+    entry.tag = NULL;
+    entry.tag_len = 0;
+
+    return hdr_log_write_entry(writer, file, &entry, histogram);
+}
+
+int hdr_log_write_entry(
+    struct hdr_log_writer* writer,
+    FILE* file,
+    const struct hdr_log_entry* entry,
+    struct hdr_histogram* histogram)
 {
     uint8_t* compressed_histogram = NULL;
     size_t compressed_len = 0;
@@ -843,10 +859,18 @@ int hdr_log_write(
         FAIL_AND_CLEANUP(cleanup, result, rc);
     }
 
+    if (NULL != entry->tag && 0 != entry->tag_len)
+    {
+        if (fprintf(file, "Tag=%.*s,", (int) entry->tag_len, entry->tag) < 0)
+        {
+            FAIL_AND_CLEANUP(cleanup, result, EIO);
+        }
+    }
+
     if (fprintf(
         file, "%.3f,%.3f,%"PRIu64".0,%s\n",
-        hdr_timespec_as_double(start_timestamp),
-        hdr_timespec_as_double(end_timestamp),
+        hdr_timespec_as_double(&entry->start_timestamp),
+        hdr_timespec_as_double(&entry->interval),
         hdr_max(histogram),
         encoded_histogram) < 0)
     {
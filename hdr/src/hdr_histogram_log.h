@@ -100,6 +100,35 @@ int hdr_log_write(
     const hdr_timespec* end_timestamp,
     struct hdr_histogram* histogram);
 
+struct hdr_log_entry
+{
+    /** Start of the interval, usually an offset from the log's start time */
+    hdr_timespec start_timestamp;
+    /** Length of the interval */
+    hdr_timespec interval;
+    /** Optional tag identifying the source of the histogram (log format 1.3),
+        tags can't contain commas or whitespace */
+    char* tag;
+    size_t tag_len;
+};
+
+/**
+ * Write an hdr_histogram entry to the log with an optional tag.  The line is
+ * the same as hdr_log_write() with "Tag=<tag>," in front of it if the entry has
+ * a tag, so several sources can share one log.
+ * @param writer 'This' pointer
+ * @param file The stream to write the entry to.
+ * @param entry The timestamps and tag to include in the logged entry.
+ * @param histogram The histogram to encode and log.
+ * @return Will return 0 if it successfully completed or an error number if there
+ * was a failure, see hdr_log_write().
+ */
+int hdr_log_write_entry(
+    struct hdr_log_writer* writer,
+    FILE* file,
+    const struct hdr_log_entry* entry,
+    struct hdr_histogram* histogram);
+
 struct hdr_log_reader
 {
     int major_version;
@@ -46,7 +46,7 @@ void hdr_mutex_destroy(struct hdr_mutex* mutex);
 void hdr_mutex_lock(struct hdr_mutex* mutex);
 void hdr_mutex_unlock(struct hdr_mutex* mutex);
 
-void hdr_yield();
+void hdr_yield(void);
 int hdr_usleep(unsigned int useconds);
 
 #ifdef __cplusplus
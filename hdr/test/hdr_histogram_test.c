@@ -222,6 +222,40 @@ static char* test_percentiles()
     return 0;
 }
 
+static char* test_value_at_percentiles()
+{
+    const double percentiles[] = { 30.0, 50.0, 75.0, 90.0, 99.0, 99.999, 100.0 };
+    const size_t length = sizeof(percentiles) / sizeof(percentiles[0]);
+    const double unsorted[] = { 90.0, 50.0 };
+    int64_t values[7];
+    double mean;
+    size_t i;
+
+    load_histograms();
+
+    mu_assert("hdr_value_at_percentiles failed",
+              hdr_value_at_percentiles(cor_histogram, percentiles, values, length) == 0);
+    for (i = 0; i < length; i++)
+    {
+        mu_assert("Value doesn't match hdr_value_at_percentile",
+                  values[i] == hdr_value_at_percentile(cor_histogram, percentiles[i]));
+    }
+
+    mu_assert("hdr_value_at_percentiles_and_mean failed",
+              hdr_value_at_percentiles_and_mean(raw_histogram, percentiles, values, length, &mean) == 0);
+    for (i = 0; i < length; i++)
+    {
+        mu_assert("Value doesn't match hdr_value_at_percentile",
+                  values[i] == hdr_value_at_percentile(raw_histogram, percentiles[i]));
+    }
+    mu_assert("Mean doesn't match hdr_mean", mean == hdr_mean(raw_histogram));
+
+    mu_assert("Unsorted percentiles accepted",
+              hdr_value_at_percentiles(raw_histogram, unsorted, values, 2) == EINVAL);
+
+    return 0;
+}
+
 
 static char* test_recorded_values()
 {
@@ -480,6 +514,7 @@ static struct mu_result all_tests()
     mu_run_test(test_get_min_value);
     mu_run_test(test_get_max_value);
     mu_run_test(test_percentiles);
+    mu_run_test(test_value_at_percentiles);
     mu_run_test(test_recorded_values);
     mu_run_test(test_linear_values);
     mu_run_test(test_logarithmic_values);
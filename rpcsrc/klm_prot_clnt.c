@@ -0,0 +1,85 @@
+/*
+ * Please do not edit this file.
+ * It was generated using rpcgen.
+ */
+
+#include <memory.h> /* for memset */
+#include "klm_prot.h"
+
+/* Default timeout can be changed using clnt_control() */
+static struct timeval TIMEOUT = { 25, 0 };
+
+void *
+klm_null_1(void *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, KLM_NULL,
+		(xdrproc_t) xdr_void, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+klm_testrply *
+klm_test_1(struct klm_testargs *argp, CLIENT *clnt)
+{
+	static klm_testrply clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, KLM_TEST,
+		(xdrproc_t) xdr_klm_testargs, (caddr_t) argp,
+		(xdrproc_t) xdr_klm_testrply, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+klm_stat *
+klm_lock_1(struct klm_lockargs *argp, CLIENT *clnt)
+{
+	static klm_stat clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, KLM_LOCK,
+		(xdrproc_t) xdr_klm_lockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_klm_stat, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+klm_stat *
+klm_cancel_1(struct klm_lockargs *argp, CLIENT *clnt)
+{
+	static klm_stat clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, KLM_CANCEL,
+		(xdrproc_t) xdr_klm_lockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_klm_stat, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+klm_stat *
+klm_unlock_1(struct klm_unlockargs *argp, CLIENT *clnt)
+{
+	static klm_stat clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, KLM_UNLOCK,
+		(xdrproc_t) xdr_klm_unlockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_klm_stat, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
@@ -0,0 +1,114 @@
+/*
+ * Please do not edit this file.
+ * It was generated using rpcgen.
+ */
+
+#include "klm_prot.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <rpc/pmap_clnt.h>
+#include <string.h>
+#include <memory.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#ifndef SIG_PF
+#define SIG_PF void(*)(int)
+#endif
+
+static void
+klm_prog_1(struct svc_req *rqstp, register SVCXPRT *transp)
+{
+	union {
+		struct klm_testargs klm_test_1_arg;
+		struct klm_lockargs klm_lock_1_arg;
+		struct klm_lockargs klm_cancel_1_arg;
+		struct klm_unlockargs klm_unlock_1_arg;
+	} argument;
+	char *result;
+	xdrproc_t _xdr_argument, _xdr_result;
+	char *(*local)(char *, struct svc_req *);
+
+	switch (rqstp->rq_proc) {
+	case KLM_NULL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) klm_null_1_svc;
+		break;
+
+	case KLM_TEST:
+		_xdr_argument = (xdrproc_t) xdr_klm_testargs;
+		_xdr_result = (xdrproc_t) xdr_klm_testrply;
+		local = (char *(*)(char *, struct svc_req *)) klm_test_1_svc;
+		break;
+
+	case KLM_LOCK:
+		_xdr_argument = (xdrproc_t) xdr_klm_lockargs;
+		_xdr_result = (xdrproc_t) xdr_klm_stat;
+		local = (char *(*)(char *, struct svc_req *)) klm_lock_1_svc;
+		break;
+
+	case KLM_CANCEL:
+		_xdr_argument = (xdrproc_t) xdr_klm_lockargs;
+		_xdr_result = (xdrproc_t) xdr_klm_stat;
+		local = (char *(*)(char *, struct svc_req *)) klm_cancel_1_svc;
+		break;
+
+	case KLM_UNLOCK:
+		_xdr_argument = (xdrproc_t) xdr_klm_unlockargs;
+		_xdr_result = (xdrproc_t) xdr_klm_stat;
+		local = (char *(*)(char *, struct svc_req *)) klm_unlock_1_svc;
+		break;
+
+	default:
+		svcerr_noproc (transp);
+		return;
+	}
+	memset ((char *)&argument, 0, sizeof (argument));
+	if (!svc_getargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		svcerr_decode (transp);
+		return;
+	}
+	result = (*local)((char *)&argument, rqstp);
+	if (result != NULL && !svc_sendreply(transp, (xdrproc_t) _xdr_result, result)) {
+		svcerr_systemerr (transp);
+	}
+	if (!svc_freeargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		fprintf (stderr, "%s", "unable to free arguments");
+		exit (1);
+	}
+	return;
+}
+
+int
+main (int argc, char **argv)
+{
+	register SVCXPRT *transp;
+
+	pmap_unset (KLM_PROG, KLM_VERS);
+
+	transp = svcudp_create(RPC_ANYSOCK);
+	if (transp == NULL) {
+		fprintf (stderr, "%s", "cannot create udp service.");
+		exit(1);
+	}
+	if (!svc_register(transp, KLM_PROG, KLM_VERS, klm_prog_1, IPPROTO_UDP)) {
+		fprintf (stderr, "%s", "unable to register (KLM_PROG, KLM_VERS, udp).");
+		exit(1);
+	}
+
+	transp = svctcp_create(RPC_ANYSOCK, 0, 0);
+	if (transp == NULL) {
+		fprintf (stderr, "%s", "cannot create tcp service.");
+		exit(1);
+	}
+	if (!svc_register(transp, KLM_PROG, KLM_VERS, klm_prog_1, IPPROTO_TCP)) {
+		fprintf (stderr, "%s", "unable to register (KLM_PROG, KLM_VERS, tcp).");
+		exit(1);
+	}
+
+	svc_run ();
+	fprintf (stderr, "%s", "svc_run returned");
+	exit (1);
+	/* NOTREACHED */
+}
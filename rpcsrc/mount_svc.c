@@ -0,0 +1,289 @@
+/*
+ * Please do not edit this file.
+ * It was generated using rpcgen.
+ */
+
+#include "mount.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <rpc/pmap_clnt.h>
+#include <string.h>
+#include <memory.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#ifndef SIG_PF
+#define SIG_PF void(*)(int)
+#endif
+#ifndef lint
+/*static char sccsid[] = "from: @(#)mount.x 1.2 87/09/18 Copyr 1987 Sun Micro";*/
+/*static char sccsid[] = "from: @(#)mount.x	2.1 88/08/01 4.0 RPCSRC";*/
+#endif /* not lint */
+#include <sys/cdefs.h>
+
+static void
+mountprog_1(struct svc_req *rqstp, register SVCXPRT *transp)
+{
+	union {
+		dirpath mountproc_mnt_1_arg;
+		dirpath mountproc_umnt_1_arg;
+	} argument;
+	char *result;
+	xdrproc_t _xdr_argument, _xdr_result;
+	char *(*local)(char *, struct svc_req *);
+
+	switch (rqstp->rq_proc) {
+	case MOUNTPROC_NULL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_null_1_svc;
+		break;
+
+	case MOUNTPROC_MNT:
+		_xdr_argument = (xdrproc_t) xdr_dirpath;
+		_xdr_result = (xdrproc_t) xdr_fhstatus;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_mnt_1_svc;
+		break;
+
+	case MOUNTPROC_DUMP:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_mountlist;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_dump_1_svc;
+		break;
+
+	case MOUNTPROC_UMNT:
+		_xdr_argument = (xdrproc_t) xdr_dirpath;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_umnt_1_svc;
+		break;
+
+	case MOUNTPROC_UMNTALL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_umntall_1_svc;
+		break;
+
+	case MOUNTPROC_EXPORT:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_exports;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_export_1_svc;
+		break;
+
+	case MOUNTPROC_EXPORTALL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_exports;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_exportall_1_svc;
+		break;
+
+	default:
+		svcerr_noproc (transp);
+		return;
+	}
+	memset ((char *)&argument, 0, sizeof (argument));
+	if (!svc_getargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		svcerr_decode (transp);
+		return;
+	}
+	result = (*local)((char *)&argument, rqstp);
+	if (result != NULL && !svc_sendreply(transp, (xdrproc_t) _xdr_result, result)) {
+		svcerr_systemerr (transp);
+	}
+	if (!svc_freeargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		fprintf (stderr, "%s", "unable to free arguments");
+		exit (1);
+	}
+	return;
+}
+
+static void
+mountprog_2(struct svc_req *rqstp, register SVCXPRT *transp)
+{
+	union {
+		dirpath mountproc_mnt_2_arg;
+		dirpath mountproc_umnt_2_arg;
+	} argument;
+	char *result;
+	xdrproc_t _xdr_argument, _xdr_result;
+	char *(*local)(char *, struct svc_req *);
+
+	switch (rqstp->rq_proc) {
+	case MOUNTPROC_NULL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_null_2_svc;
+		break;
+
+	case MOUNTPROC_MNT:
+		_xdr_argument = (xdrproc_t) xdr_dirpath;
+		_xdr_result = (xdrproc_t) xdr_fhstatus;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_mnt_2_svc;
+		break;
+
+	case MOUNTPROC_DUMP:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_mountlist;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_dump_2_svc;
+		break;
+
+	case MOUNTPROC_UMNT:
+		_xdr_argument = (xdrproc_t) xdr_dirpath;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_umnt_2_svc;
+		break;
+
+	case MOUNTPROC_UMNTALL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_umntall_2_svc;
+		break;
+
+	case MOUNTPROC_EXPORT:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_exports;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_export_2_svc;
+		break;
+
+	case MOUNTPROC_EXPORTALL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_exports;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_exportall_2_svc;
+		break;
+
+	default:
+		svcerr_noproc (transp);
+		return;
+	}
+	memset ((char *)&argument, 0, sizeof (argument));
+	if (!svc_getargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		svcerr_decode (transp);
+		return;
+	}
+	result = (*local)((char *)&argument, rqstp);
+	if (result != NULL && !svc_sendreply(transp, (xdrproc_t) _xdr_result, result)) {
+		svcerr_systemerr (transp);
+	}
+	if (!svc_freeargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		fprintf (stderr, "%s", "unable to free arguments");
+		exit (1);
+	}
+	return;
+}
+
+static void
+mountprog_3(struct svc_req *rqstp, register SVCXPRT *transp)
+{
+	union {
+		dirpath mountproc_mnt_3_arg;
+		dirpath mountproc_umnt_3_arg;
+	} argument;
+	char *result;
+	xdrproc_t _xdr_argument, _xdr_result;
+	char *(*local)(char *, struct svc_req *);
+
+	switch (rqstp->rq_proc) {
+	case MOUNTPROC_NULL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_null_3_svc;
+		break;
+
+	case MOUNTPROC_MNT:
+		_xdr_argument = (xdrproc_t) xdr_dirpath;
+		_xdr_result = (xdrproc_t) xdr_mountres3;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_mnt_3_svc;
+		break;
+
+	case MOUNTPROC_DUMP:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_mountlist;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_dump_3_svc;
+		break;
+
+	case MOUNTPROC_UMNT:
+		_xdr_argument = (xdrproc_t) xdr_dirpath;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_umnt_3_svc;
+		break;
+
+	case MOUNTPROC_UMNTALL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_umntall_3_svc;
+		break;
+
+	case MOUNTPROC_EXPORT:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_exports;
+		local = (char *(*)(char *, struct svc_req *)) mountproc_export_3_svc;
+		break;
+
+	default:
+		svcerr_noproc (transp);
+		return;
+	}
+	memset ((char *)&argument, 0, sizeof (argument));
+	if (!svc_getargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		svcerr_decode (transp);
+		return;
+	}
+	result = (*local)((char *)&argument, rqstp);
+	if (result != NULL && !svc_sendreply(transp, (xdrproc_t) _xdr_result, result)) {
+		svcerr_systemerr (transp);
+	}
+	if (!svc_freeargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		fprintf (stderr, "%s", "unable to free arguments");
+		exit (1);
+	}
+	return;
+}
+
+int
+main (int argc, char **argv)
+{
+	register SVCXPRT *transp;
+
+	pmap_unset (MOUNTPROG, MOUNTVERS);
+	pmap_unset (MOUNTPROG, MOUNTVERS2);
+	pmap_unset (MOUNTPROG, MOUNTVERS3);
+
+	transp = svcudp_create(RPC_ANYSOCK);
+	if (transp == NULL) {
+		fprintf (stderr, "%s", "cannot create udp service.");
+		exit(1);
+	}
+	if (!svc_register(transp, MOUNTPROG, MOUNTVERS, mountprog_1, IPPROTO_UDP)) {
+		fprintf (stderr, "%s", "unable to register (MOUNTPROG, MOUNTVERS, udp).");
+		exit(1);
+	}
+	if (!svc_register(transp, MOUNTPROG, MOUNTVERS2, mountprog_2, IPPROTO_UDP)) {
+		fprintf (stderr, "%s", "unable to register (MOUNTPROG, MOUNTVERS2, udp).");
+		exit(1);
+	}
+	if (!svc_register(transp, MOUNTPROG, MOUNTVERS3, mountprog_3, IPPROTO_UDP)) {
+		fprintf (stderr, "%s", "unable to register (MOUNTPROG, MOUNTVERS3, udp).");
+		exit(1);
+	}
+
+	transp = svctcp_create(RPC_ANYSOCK, 0, 0);
+	if (transp == NULL) {
+		fprintf (stderr, "%s", "cannot create tcp service.");
+		exit(1);
+	}
+	if (!svc_register(transp, MOUNTPROG, MOUNTVERS, mountprog_1, IPPROTO_TCP)) {
+		fprintf (stderr, "%s", "unable to register (MOUNTPROG, MOUNTVERS, tcp).");
+		exit(1);
+	}
+	if (!svc_register(transp, MOUNTPROG, MOUNTVERS2, mountprog_2, IPPROTO_TCP)) {
+		fprintf (stderr, "%s", "unable to register (MOUNTPROG, MOUNTVERS2, tcp).");
+		exit(1);
+	}
+	if (!svc_register(transp, MOUNTPROG, MOUNTVERS3, mountprog_3, IPPROTO_TCP)) {
+		fprintf (stderr, "%s", "unable to register (MOUNTPROG, MOUNTVERS3, tcp).");
+		exit(1);
+	}
+
+	svc_run ();
+	fprintf (stderr, "%s", "svc_run returned");
+	exit (1);
+	/* NOTREACHED */
+}
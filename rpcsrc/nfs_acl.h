@@ -0,0 +1,51 @@
+/*
+ * Please do not edit this file.
+ * It was generated using rpcgen.
+ */
+
+#ifndef _NFS_ACL_H_RPCGEN
+#define _NFS_ACL_H_RPCGEN
+
+#include <rpc/rpc.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define NFS_ACL_PROGRAM 100227
+#define NFS_ACL_V2 2
+
+#if defined(__STDC__) || defined(__cplusplus)
+#define ACLPROC2_NULL 0
+extern  void * aclproc2_null_2(void *, CLIENT *);
+extern  void * aclproc2_null_2_svc(void *, struct svc_req *);
+extern int nfs_acl_program_2_freeresult (SVCXPRT *, xdrproc_t, caddr_t);
+
+#else /* K&R C */
+#define ACLPROC2_NULL 0
+extern  void * aclproc2_null_2();
+extern  void * aclproc2_null_2_svc();
+extern int nfs_acl_program_2_freeresult ();
+#endif /* K&R C */
+#define NFS_ACL_V3 3
+
+#if defined(__STDC__) || defined(__cplusplus)
+#define ACLPROC3_NULL 0
+extern  void * aclproc3_null_3(void *, CLIENT *);
+extern  void * aclproc3_null_3_svc(void *, struct svc_req *);
+extern int nfs_acl_program_3_freeresult (SVCXPRT *, xdrproc_t, caddr_t);
+
+#else /* K&R C */
+#define ACLPROC3_NULL 0
+extern  void * aclproc3_null_3();
+extern  void * aclproc3_null_3_svc();
+extern int nfs_acl_program_3_freeresult ();
+#endif /* K&R C */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !_NFS_ACL_H_RPCGEN */
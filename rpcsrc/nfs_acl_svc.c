@@ -0,0 +1,133 @@
+/*
+ * Please do not edit this file.
+ * It was generated using rpcgen.
+ */
+
+#include "nfs_acl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <rpc/pmap_clnt.h>
+#include <string.h>
+#include <memory.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#ifndef SIG_PF
+#define SIG_PF void(*)(int)
+#endif
+
+static void
+nfs_acl_program_2(struct svc_req *rqstp, register SVCXPRT *transp)
+{
+	union {
+		int fill;
+	} argument;
+	char *result;
+	xdrproc_t _xdr_argument, _xdr_result;
+	char *(*local)(char *, struct svc_req *);
+
+	switch (rqstp->rq_proc) {
+	case ACLPROC2_NULL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) aclproc2_null_2_svc;
+		break;
+
+	default:
+		svcerr_noproc (transp);
+		return;
+	}
+	memset ((char *)&argument, 0, sizeof (argument));
+	if (!svc_getargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		svcerr_decode (transp);
+		return;
+	}
+	result = (*local)((char *)&argument, rqstp);
+	if (result != NULL && !svc_sendreply(transp, (xdrproc_t) _xdr_result, result)) {
+		svcerr_systemerr (transp);
+	}
+	if (!svc_freeargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		fprintf (stderr, "%s", "unable to free arguments");
+		exit (1);
+	}
+	return;
+}
+
+static void
+nfs_acl_program_3(struct svc_req *rqstp, register SVCXPRT *transp)
+{
+	union {
+		int fill;
+	} argument;
+	char *result;
+	xdrproc_t _xdr_argument, _xdr_result;
+	char *(*local)(char *, struct svc_req *);
+
+	switch (rqstp->rq_proc) {
+	case ACLPROC3_NULL:
+		_xdr_argument = (xdrproc_t) xdr_void;
+		_xdr_result = (xdrproc_t) xdr_void;
+		local = (char *(*)(char *, struct svc_req *)) aclproc3_null_3_svc;
+		break;
+
+	default:
+		svcerr_noproc (transp);
+		return;
+	}
+	memset ((char *)&argument, 0, sizeof (argument));
+	if (!svc_getargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		svcerr_decode (transp);
+		return;
+	}
+	result = (*local)((char *)&argument, rqstp);
+	if (result != NULL && !svc_sendreply(transp, (xdrproc_t) _xdr_result, result)) {
+		svcerr_systemerr (transp);
+	}
+	if (!svc_freeargs (transp, (xdrproc_t) _xdr_argument, (caddr_t) &argument)) {
+		fprintf (stderr, "%s", "unable to free arguments");
+		exit (1);
+	}
+	return;
+}
+
+int
+main (int argc, char **argv)
+{
+	register SVCXPRT *transp;
+
+	pmap_unset (NFS_ACL_PROGRAM, NFS_ACL_V2);
+	pmap_unset (NFS_ACL_PROGRAM, NFS_ACL_V3);
+
+	transp = svcudp_create(RPC_ANYSOCK);
+	if (transp == NULL) {
+		fprintf (stderr, "%s", "cannot create udp service.");
+		exit(1);
+	}
+	if (!svc_register(transp, NFS_ACL_PROGRAM, NFS_ACL_V2, nfs_acl_program_2, IPPROTO_UDP)) {
+		fprintf (stderr, "%s", "unable to register (NFS_ACL_PROGRAM, NFS_ACL_V2, udp).");
+		exit(1);
+	}
+	if (!svc_register(transp, NFS_ACL_PROGRAM, NFS_ACL_V3, nfs_acl_program_3, IPPROTO_UDP)) {
+		fprintf (stderr, "%s", "unable to register (NFS_ACL_PROGRAM, NFS_ACL_V3, udp).");
+		exit(1);
+	}
+
+	transp = svctcp_create(RPC_ANYSOCK, 0, 0);
+	if (transp == NULL) {
+		fprintf (stderr, "%s", "cannot create tcp service.");
+		exit(1);
+	}
+	if (!svc_register(transp, NFS_ACL_PROGRAM, NFS_ACL_V2, nfs_acl_program_2, IPPROTO_TCP)) {
+		fprintf (stderr, "%s", "unable to register (NFS_ACL_PROGRAM, NFS_ACL_V2, tcp).");
+		exit(1);
+	}
+	if (!svc_register(transp, NFS_ACL_PROGRAM, NFS_ACL_V3, nfs_acl_program_3, IPPROTO_TCP)) {
+		fprintf (stderr, "%s", "unable to register (NFS_ACL_PROGRAM, NFS_ACL_V3, tcp).");
+		exit(1);
+	}
+
+	svc_run ();
+	fprintf (stderr, "%s", "svc_run returned");
+	exit (1);
+	/* NOTREACHED */
+}
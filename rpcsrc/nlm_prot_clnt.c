@@ -0,0 +1,646 @@
+/*
+ * Please do not edit this file.
+ * It was generated using rpcgen.
+ */
+
+#include <memory.h> /* for memset */
+#include "nlm_prot.h"
+#include <sys/cdefs.h>
+#ifndef lint
+/*static char sccsid[] = "from: @(#)nlm_prot.x 1.8 87/09/21 Copyr 1987 Sun Micro";*/
+/*static char sccsid[] = "from: * @(#)nlm_prot.x	2.1 88/08/01 4.0 RPCSRC";*/
+/*static char rcsid[] = "$NetBSD: nlm_prot.x,v 1.6 2000/06/07 14:30:15 bouyer Exp $";*/
+#endif /* not lint */
+
+/* Default timeout can be changed using clnt_control() */
+static struct timeval TIMEOUT = { 25, 0 };
+
+void *
+nlm_sm_notify_0(struct nlm_sm_status *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_SM_NOTIFY,
+		(xdrproc_t) xdr_nlm_sm_status, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_null_1(void *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_NULL,
+		(xdrproc_t) xdr_void, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+nlm_testres *
+nlm_test_1(struct nlm_testargs *argp, CLIENT *clnt)
+{
+	static nlm_testres clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_TEST,
+		(xdrproc_t) xdr_nlm_testargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm_testres, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm_res *
+nlm_lock_1(struct nlm_lockargs *argp, CLIENT *clnt)
+{
+	static nlm_res clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_LOCK,
+		(xdrproc_t) xdr_nlm_lockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm_res, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm_res *
+nlm_cancel_1(struct nlm_cancargs *argp, CLIENT *clnt)
+{
+	static nlm_res clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_CANCEL,
+		(xdrproc_t) xdr_nlm_cancargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm_res, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm_res *
+nlm_unlock_1(struct nlm_unlockargs *argp, CLIENT *clnt)
+{
+	static nlm_res clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_UNLOCK,
+		(xdrproc_t) xdr_nlm_unlockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm_res, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm_res *
+nlm_granted_1(struct nlm_testargs *argp, CLIENT *clnt)
+{
+	static nlm_res clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_GRANTED,
+		(xdrproc_t) xdr_nlm_testargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm_res, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+void *
+nlm_test_msg_1(struct nlm_testargs *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_TEST_MSG,
+		(xdrproc_t) xdr_nlm_testargs, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_lock_msg_1(struct nlm_lockargs *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_LOCK_MSG,
+		(xdrproc_t) xdr_nlm_lockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_cancel_msg_1(struct nlm_cancargs *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_CANCEL_MSG,
+		(xdrproc_t) xdr_nlm_cancargs, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_unlock_msg_1(struct nlm_unlockargs *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_UNLOCK_MSG,
+		(xdrproc_t) xdr_nlm_unlockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_granted_msg_1(struct nlm_testargs *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_GRANTED_MSG,
+		(xdrproc_t) xdr_nlm_testargs, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_test_res_1(nlm_testres *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_TEST_RES,
+		(xdrproc_t) xdr_nlm_testres, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_lock_res_1(nlm_res *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_LOCK_RES,
+		(xdrproc_t) xdr_nlm_res, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_cancel_res_1(nlm_res *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_CANCEL_RES,
+		(xdrproc_t) xdr_nlm_res, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_unlock_res_1(nlm_res *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_UNLOCK_RES,
+		(xdrproc_t) xdr_nlm_res, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_granted_res_1(nlm_res *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_GRANTED_RES,
+		(xdrproc_t) xdr_nlm_res, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm_null_3(void *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_NULL,
+		(xdrproc_t) xdr_void, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+nlm_shareres *
+nlm_share_3(nlm_shareargs *argp, CLIENT *clnt)
+{
+	static nlm_shareres clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_SHARE,
+		(xdrproc_t) xdr_nlm_shareargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm_shareres, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm_shareres *
+nlm_unshare_3(nlm_shareargs *argp, CLIENT *clnt)
+{
+	static nlm_shareres clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_UNSHARE,
+		(xdrproc_t) xdr_nlm_shareargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm_shareres, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm_res *
+nlm_nm_lock_3(nlm_lockargs *argp, CLIENT *clnt)
+{
+	static nlm_res clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_NM_LOCK,
+		(xdrproc_t) xdr_nlm_lockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm_res, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+void *
+nlm_free_all_3(nlm_notify *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM_FREE_ALL,
+		(xdrproc_t) xdr_nlm_notify, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm4_null_4(void *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_NULL,
+		(xdrproc_t) xdr_void, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+nlm4_testres *
+nlm4_test_4(nlm4_testargs *argp, CLIENT *clnt)
+{
+	static nlm4_testres clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_TEST,
+		(xdrproc_t) xdr_nlm4_testargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm4_testres, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm4_res *
+nlm4_lock_4(nlm4_lockargs *argp, CLIENT *clnt)
+{
+	static nlm4_res clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_LOCK,
+		(xdrproc_t) xdr_nlm4_lockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm4_res, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm4_res *
+nlm4_cancel_4(nlm4_cancargs *argp, CLIENT *clnt)
+{
+	static nlm4_res clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_CANCEL,
+		(xdrproc_t) xdr_nlm4_cancargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm4_res, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm4_res *
+nlm4_unlock_4(nlm4_unlockargs *argp, CLIENT *clnt)
+{
+	static nlm4_res clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_UNLOCK,
+		(xdrproc_t) xdr_nlm4_unlockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm4_res, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm4_res *
+nlm4_granted_4(nlm4_testargs *argp, CLIENT *clnt)
+{
+	static nlm4_res clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_GRANTED,
+		(xdrproc_t) xdr_nlm4_testargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm4_res, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+void *
+nlm4_test_msg_4(nlm4_testargs *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_TEST_MSG,
+		(xdrproc_t) xdr_nlm4_testargs, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm4_lock_msg_4(nlm4_lockargs *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_LOCK_MSG,
+		(xdrproc_t) xdr_nlm4_lockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm4_cancel_msg_4(nlm4_cancargs *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_CANCEL_MSG,
+		(xdrproc_t) xdr_nlm4_cancargs, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm4_unlock_msg_4(nlm4_unlockargs *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_UNLOCK_MSG,
+		(xdrproc_t) xdr_nlm4_unlockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm4_granted_msg_4(nlm4_testargs *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_GRANTED_MSG,
+		(xdrproc_t) xdr_nlm4_testargs, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm4_test_res_4(nlm4_testres *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_TEST_RES,
+		(xdrproc_t) xdr_nlm4_testres, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm4_lock_res_4(nlm4_res *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_LOCK_RES,
+		(xdrproc_t) xdr_nlm4_res, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm4_cancel_res_4(nlm4_res *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_CANCEL_RES,
+		(xdrproc_t) xdr_nlm4_res, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm4_unlock_res_4(nlm4_res *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_UNLOCK_RES,
+		(xdrproc_t) xdr_nlm4_res, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+void *
+nlm4_granted_res_4(nlm4_res *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_GRANTED_RES,
+		(xdrproc_t) xdr_nlm4_res, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+nlm4_shareres *
+nlm4_share_4(nlm4_shareargs *argp, CLIENT *clnt)
+{
+	static nlm4_shareres clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_SHARE,
+		(xdrproc_t) xdr_nlm4_shareargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm4_shareres, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm4_shareres *
+nlm4_unshare_4(nlm4_shareargs *argp, CLIENT *clnt)
+{
+	static nlm4_shareres clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_UNSHARE,
+		(xdrproc_t) xdr_nlm4_shareargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm4_shareres, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+nlm4_res *
+nlm4_nm_lock_4(nlm4_lockargs *argp, CLIENT *clnt)
+{
+	static nlm4_res clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_NM_LOCK,
+		(xdrproc_t) xdr_nlm4_lockargs, (caddr_t) argp,
+		(xdrproc_t) xdr_nlm4_res, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+void *
+nlm4_free_all_4(nlm4_notify *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, NLM4_FREE_ALL,
+		(xdrproc_t) xdr_nlm4_notify, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
@@ -0,0 +1,251 @@
+/*
+ * Please do not edit this file.
+ * It was generated using rpcgen.
+ */
+
+#include "pmap_prot.h"
+/*
+ * Sun RPC is a product of Sun Microsystems, Inc. and is provided for
+ * unrestricted use provided that this legend is included on all tape
+ * media and as a part of the software program in whole or part.  Users
+ * may copy or modify Sun RPC without charge, but are not authorized
+ * to license or distribute it to anyone else except as part of a product or
+ * program developed by the user.
+ *
+ * SUN RPC IS PROVIDED AS IS WITH NO WARRANTIES OF ANY KIND INCLUDING THE
+ * WARRANTIES OF DESIGN, MERCHANTIBILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE, OR ARISING FROM A COURSE OF DEALING, USAGE OR TRADE PRACTICE.
+ *
+ * Sun RPC is provided with no support and without any obligation on the
+ * part of Sun Microsystems, Inc. to assist in its use, correction,
+ * modification or enhancement.
+ *
+ * SUN MICROSYSTEMS, INC. SHALL HAVE NO LIABILITY WITH RESPECT TO THE
+ * INFRINGEMENT OF COPYRIGHTS, TRADE SECRETS OR ANY PATENTS BY SUN RPC
+ * OR ANY PART THEREOF.
+ *
+ * In no event will Sun Microsystems, Inc. be liable for any lost revenue
+ * or profits or other special, indirect and consequential damages, even if
+ * Sun has been advised of the possibility of such damages.
+ *
+ * Sun Microsystems, Inc.
+ * 2550 Garcia Avenue
+ * Mountain View, California  94043
+ */
+/*
+ * Copyright (c) 1984,1989 by Sun Microsystems, Inc.
+ */
+/* from pmap_prot.x */
+/*
+ * Protocol for the local binder service, or pmap.
+ *
+ * Copyright (C) 1984, Sun Microsystems, Inc.
+ *
+ * The following procedures are supported by the protocol:
+ *
+ * PMAPPROC_NULL() returns ()
+ * 	takes nothing, returns nothing
+ *
+ * PMAPPROC_SET(struct pmap) returns (bool_t)
+ * 	TRUE is success, FALSE is failure.  Registers the tuple
+ *	[prog, vers, prot, port].
+ *
+ * PMAPPROC_UNSET(struct pmap) returns (bool_t)
+ *	TRUE is success, FALSE is failure.  Un-registers pair
+ *	[prog, vers].  prot and port are ignored.
+ *
+ * PMAPPROC_GETPORT(struct pmap) returns (long unsigned).
+ *	0 is failure.  Otherwise returns the port number where the pair
+ *	[prog, vers] is registered.  It may lie!
+ *
+ * PMAPPROC_DUMP() RETURNS (struct pmaplist_ptr)
+ *
+ * PMAPPROC_CALLIT(unsigned, unsigned, unsigned, string<>)
+ * 	RETURNS (port, string<>);
+ * usage: encapsulatedresults = PMAPPROC_CALLIT(prog, vers, proc,
+ *						encapsulatedargs);
+ * 	Calls the procedure on the local machine.  If it is not registered,
+ *	this procedure is quite; ie it does not return error information!!!
+ *	This procedure only is supported on rpc/udp and calls via
+ *	rpc/udp.  This routine only passes null authentication parameters.
+ *	This file has no interface to xdr routines for PMAPPROC_CALLIT.
+ *
+ * The service supports remote procedure calls on udp/ip or tcp/ip socket 111.
+ */
+
+
+
+/*
+ * A mapping of (program, version, protocol) to port number
+ */
+
+bool_t
+xdr_pmap (XDR *xdrs, pmap *objp)
+{
+	register int32_t *buf;
+
+
+	if (xdrs->x_op == XDR_ENCODE) {
+		buf = XDR_INLINE (xdrs, 4 * BYTES_PER_XDR_UNIT);
+		if (buf == NULL) {
+			 if (!xdr_u_long (xdrs, &objp->pm_prog))
+				 return FALSE;
+			 if (!xdr_u_long (xdrs, &objp->pm_vers))
+				 return FALSE;
+			 if (!xdr_u_long (xdrs, &objp->pm_prot))
+				 return FALSE;
+			 if (!xdr_u_long (xdrs, &objp->pm_port))
+				 return FALSE;
+		} else {
+			IXDR_PUT_U_LONG(buf, objp->pm_prog);
+			IXDR_PUT_U_LONG(buf, objp->pm_vers);
+			IXDR_PUT_U_LONG(buf, objp->pm_prot);
+			IXDR_PUT_U_LONG(buf, objp->pm_port);
+		}
+		return TRUE;
+	} else if (xdrs->x_op == XDR_DECODE) {
+		buf = XDR_INLINE (xdrs, 4 * BYTES_PER_XDR_UNIT);
+		if (buf == NULL) {
+			 if (!xdr_u_long (xdrs, &objp->pm_prog))
+				 return FALSE;
+			 if (!xdr_u_long (xdrs, &objp->pm_vers))
+				 return FALSE;
+			 if (!xdr_u_long (xdrs, &objp->pm_prot))
+				 return FALSE;
+			 if (!xdr_u_long (xdrs, &objp->pm_port))
+				 return FALSE;
+		} else {
+			objp->pm_prog = IXDR_GET_U_LONG(buf);
+			objp->pm_vers = IXDR_GET_U_LONG(buf);
+			objp->pm_prot = IXDR_GET_U_LONG(buf);
+			objp->pm_port = IXDR_GET_U_LONG(buf);
+		}
+	 return TRUE;
+	}
+
+	 if (!xdr_u_long (xdrs, &objp->pm_prog))
+		 return FALSE;
+	 if (!xdr_u_long (xdrs, &objp->pm_vers))
+		 return FALSE;
+	 if (!xdr_u_long (xdrs, &objp->pm_prot))
+		 return FALSE;
+	 if (!xdr_u_long (xdrs, &objp->pm_port))
+		 return FALSE;
+	return TRUE;
+}
+
+/*
+ * Supported values for the "prot" field
+ */
+
+
+
+/*
+ * A list of mappings
+ *
+ * Below are two definitions for the pmaplist structure.  This is done because
+ * xdr_pmaplist() is specified to take a struct pmaplist **, rather than a
+ * struct pmaplist * that rpcgen would produce.  One version of the pmaplist
+ * structure (actually called pm__list) is used with rpcgen, and the other is
+ * defined only in the header file for compatibility with the specified
+ * interface.
+ */
+
+bool_t
+xdr_pm__list (XDR *xdrs, pm__list *objp)
+{
+	register int32_t *buf;
+
+	 if (!xdr_pmap (xdrs, &objp->pml_map))
+		 return FALSE;
+	 if (!xdr_pointer (xdrs, (char **)&objp->pml_next, sizeof (pm__list), (xdrproc_t) xdr_pm__list))
+		 return FALSE;
+	return TRUE;
+}
+
+bool_t
+xdr_pmaplist_ptr (XDR *xdrs, pmaplist_ptr *objp)
+{
+	register int32_t *buf;
+
+	 if (!xdr_pointer (xdrs, (char **)objp, sizeof (pm__list), (xdrproc_t) xdr_pm__list))
+		 return FALSE;
+	return TRUE;
+}
+
+/*
+ * Arguments to callit
+ */
+
+bool_t
+xdr_rmtcallargs (XDR *xdrs, rmtcallargs *objp)
+{
+	register int32_t *buf;
+
+
+	if (xdrs->x_op == XDR_ENCODE) {
+		buf = XDR_INLINE (xdrs, 3 * BYTES_PER_XDR_UNIT);
+		if (buf == NULL) {
+			 if (!xdr_u_long (xdrs, &objp->prog))
+				 return FALSE;
+			 if (!xdr_u_long (xdrs, &objp->vers))
+				 return FALSE;
+			 if (!xdr_u_long (xdrs, &objp->proc))
+				 return FALSE;
+
+		} else {
+		IXDR_PUT_U_LONG(buf, objp->prog);
+		IXDR_PUT_U_LONG(buf, objp->vers);
+		IXDR_PUT_U_LONG(buf, objp->proc);
+		}
+		 if (!xdr_bytes (xdrs, (char **)&objp->args.args_val, (u_int *) &objp->args.args_len, ~0))
+			 return FALSE;
+		return TRUE;
+	} else if (xdrs->x_op == XDR_DECODE) {
+		buf = XDR_INLINE (xdrs, 3 * BYTES_PER_XDR_UNIT);
+		if (buf == NULL) {
+			 if (!xdr_u_long (xdrs, &objp->prog))
+				 return FALSE;
+			 if (!xdr_u_long (xdrs, &objp->vers))
+				 return FALSE;
+			 if (!xdr_u_long (xdrs, &objp->proc))
+				 return FALSE;
+
+		} else {
+		objp->prog = IXDR_GET_U_LONG(buf);
+		objp->vers = IXDR_GET_U_LONG(buf);
+		objp->proc = IXDR_GET_U_LONG(buf);
+		}
+		 if (!xdr_bytes (xdrs, (char **)&objp->args.args_val, (u_int *) &objp->args.args_len, ~0))
+			 return FALSE;
+	 return TRUE;
+	}
+
+	 if (!xdr_u_long (xdrs, &objp->prog))
+		 return FALSE;
+	 if (!xdr_u_long (xdrs, &objp->vers))
+		 return FALSE;
+	 if (!xdr_u_long (xdrs, &objp->proc))
+		 return FALSE;
+	 if (!xdr_bytes (xdrs, (char **)&objp->args.args_val, (u_int *) &objp->args.args_len, ~0))
+		 return FALSE;
+	return TRUE;
+}
+
+
+/*
+ * Results of callit
+ */
+
+bool_t
+xdr_rmtcallres (XDR *xdrs, rmtcallres *objp)
+{
+	register int32_t *buf;
+
+	 if (!xdr_u_long (xdrs, &objp->port))
+		 return FALSE;
+	 if (!xdr_bytes (xdrs, (char **)&objp->res.res_val, (u_int *) &objp->res.res_len, ~0))
+		 return FALSE;
+	return TRUE;
+}
+
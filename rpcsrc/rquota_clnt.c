@@ -0,0 +1,60 @@
+/*
+ * Please do not edit this file.
+ * It was generated using rpcgen.
+ */
+
+#include <memory.h> /* for memset */
+#include "rquota.h"
+#ifndef lint
+/*static char sccsid[] = "from: @(#)rquota.x 1.2 87/09/20 Copyr 1987 Sun Micro";*/
+/*static char sccsid[] = "from: @(#)rquota.x	2.1 88/08/01 4.0 RPCSRC";*/
+#endif /* not lint */
+#include <sys/cdefs.h>
+
+/* Default timeout can be changed using clnt_control() */
+static struct timeval TIMEOUT = { 25, 0 };
+
+void *
+rquotaproc_null_1(void *argp, CLIENT *clnt)
+{
+	static char clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, RQUOTAPROC_NULL,
+		(xdrproc_t) xdr_void, (caddr_t) argp,
+		(xdrproc_t) xdr_void, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return ((void *)&clnt_res);
+}
+
+getquota_rslt *
+rquotaproc_getquota_1(getquota_args *argp, CLIENT *clnt)
+{
+	static getquota_rslt clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, RQUOTAPROC_GETQUOTA,
+		(xdrproc_t) xdr_getquota_args, (caddr_t) argp,
+		(xdrproc_t) xdr_getquota_rslt, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
+
+getquota_rslt *
+rquotaproc_getactivequota_1(getquota_args *argp, CLIENT *clnt)
+{
+	static getquota_rslt clnt_res;
+
+	memset((char *)&clnt_res, 0, sizeof(clnt_res));
+	if (clnt_call (clnt, RQUOTAPROC_GETACTIVEQUOTA,
+		(xdrproc_t) xdr_getquota_args, (caddr_t) argp,
+		(xdrproc_t) xdr_getquota_rslt, (caddr_t) &clnt_res,
+		TIMEOUT) != RPC_SUCCESS) {
+		return (NULL);
+	}
+	return (&clnt_res);
+}
@@ -0,0 +1,1667 @@
+/* asynchronous RPC NULL requests using epoll */
+/* sends requests to all targets at once instead of waiting for each response in turn */
+/* responses are matched to requests by XID */
+/* requests on shared sockets are sent in batches with sendmmsg() and responses are read with recvmmsg() */
+/* optionally uses kernel timestamps to time requests from when they leave to when the response arrives */
+/* requests are sent on a fixed schedule (open loop) so a slow server doesn't delay the requests after it */
+
+#include "nfsping.h"
+#include "rpc.h"
+#include "util.h"
+#include "async.h"
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <fcntl.h>
+#include <linux/net_tstamp.h>
+#include <linux/errqueue.h>
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+/* globals */
+extern int verbose;
+
+/* the largest datagram we expect in response to a NULL request */
+/* replies are only a few words long but leave space for a verifier */
+#define ASYNC_BUFSIZE 512
+
+/* socket buffer size to ask for on shared sockets so bursts of responses don't get dropped */
+/* the kernel limits this to net.core.rmem_max */
+#define ASYNC_SOCKBUF (4 * 1024 * 1024)
+
+/* software timestamps for outgoing and incoming packets */
+/* OPT_ID numbers each request so the transmit timestamps can be matched up, OPT_TSONLY leaves the packet off the error queue */
+#define ASYNC_TIMESTAMPING (SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY)
+
+/* space for the timestamp control messages */
+#define ASYNC_CONTROL 256
+
+/* requests queued on a shared socket to go out with one sendmmsg() */
+struct async_batch {
+    unsigned int count;
+    struct mmsghdr msgs[ASYNC_BATCH];
+    struct iovec iovs[ASYNC_BATCH];
+    char bufs[ASYNC_BATCH][ASYNC_REQUEST];
+    struct async_call *calls[ASYNC_BATCH];
+    /* when each request was due, for measuring jitter */
+    struct timespec scheduled[ASYNC_BATCH];
+};
+
+/* buffers for reading responses with recvmmsg() */
+struct async_recv {
+    struct mmsghdr msgs[ASYNC_BATCH];
+    struct iovec iovs[ASYNC_BATCH];
+    struct sockaddr_in from[ASYNC_BATCH];
+    char bufs[ASYNC_BATCH][ASYNC_BUFSIZE];
+    char control[ASYNC_BATCH][ASYNC_CONTROL];
+};
+
+
+/* grab a monotonic timestamp for measuring elapsed time */
+static void async_clock(struct timespec *ts) {
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, ts);
+#else
+    clock_gettime(CLOCK_MONOTONIC, ts);
+#endif
+}
+
+
+/* work out when a call will time out */
+static void call_deadline(const struct async_engine *engine, const struct async_call *call, struct timespec *deadline) {
+    struct timespec timeout = {
+        .tv_sec  = engine->timeout.tv_sec,
+        .tv_nsec = engine->timeout.tv_usec * 1000,
+    };
+
+    timespecadd(&call->sent, &timeout, deadline);
+}
+
+
+/* add a call to the end of the in flight list */
+static void inflight_append(struct async_engine *engine, struct async_call *call) {
+    call->next = NULL;
+    call->prev = engine->newest;
+
+    if (engine->newest) {
+        engine->newest->next = call;
+    } else {
+        engine->oldest = call;
+    }
+
+    engine->newest = call;
+    engine->outstanding++;
+}
+
+
+/* take a call out of the in flight list and put its slot back on the free list */
+static void inflight_remove(struct async_engine *engine, struct async_call *call) {
+    if (call->prev) {
+        call->prev->next = call->next;
+    } else {
+        engine->oldest = call->next;
+    }
+
+    if (call->next) {
+        call->next->prev = call->prev;
+    } else {
+        engine->newest = call->prev;
+    }
+
+    engine->targets[call->index].outstanding--;
+    engine->outstanding--;
+
+    call->index = -1;
+    call->prev = NULL;
+    call->next = engine->free;
+    engine->free = call;
+}
+
+
+/* close a target's connected socket, this also removes it from epoll */
+static void close_target(struct async_target *target) {
+    if (target->connected.sock >= 0) {
+        close(target->connected.sock);
+        target->connected.sock = -1;
+    }
+}
+
+
+/* make a socket nonblocking and add it to epoll */
+/* returns 0 or -1 on error */
+static int watch_socket(struct async_engine *engine, struct async_socket *socket) {
+    struct epoll_event event = {
+        .events = EPOLLIN,
+        .data.ptr = socket,
+    };
+
+    if (fcntl(socket->sock, F_SETFL, fcntl(socket->sock, F_GETFL) | O_NONBLOCK) == -1) {
+        perror("watch_socket(fcntl)");
+        return -1;
+    }
+
+    if (epoll_ctl(engine->epoll_fd, EPOLL_CTL_ADD, socket->sock, &event) == -1) {
+        perror("watch_socket(epoll_ctl)");
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/* turn on kernel timestamps for a socket */
+/* returns 0 or -1 on error */
+static int enable_timestamps(int sock) {
+    int flags = ASYNC_TIMESTAMPING;
+
+    if (setsockopt(sock, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == -1) {
+        perror("enable_timestamps(setsockopt)");
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/* get a socket ready to send to a target */
+/* either the shared socket or a new nonblocking UDP socket connected to the target */
+/* returns the socket or -1 on error */
+static int open_target(struct async_engine *engine, struct async_target *target) {
+    struct addrinfo hints = {
+        .ai_family = AF_INET,
+        .ai_socktype = SOCK_DGRAM,
+    };
+
+    /* look up the port the first time if we're using the portmapper */
+    /* this blocks but only happens once per target */
+    if (target->target->client_sock->sin_port == 0) {
+        target->target->client_sock->sin_port = portmap_lookup(target->target->client_sock, &hints, engine->prognum, engine->version, engine->timeout, engine->src_ip);
+        if (target->target->client_sock->sin_port == 0) {
+            return -1;
+        }
+    }
+
+    if (target->shared) {
+        return target->shared->sock;
+    }
+
+    target->connected.sock = create_rpc_socket(target->target->client_sock, SOCK_DGRAM, engine->src_ip);
+    engine->stats.sockets++;
+
+    if (target->connected.sock >= 0 && watch_socket(engine, &target->connected) == -1) {
+        close_target(target);
+    }
+
+    /* the timestamp keys start again from zero on each new socket */
+    if (target->connected.sock >= 0 && engine->timestamps) {
+        target->connected.tskey = 0;
+        if (enable_timestamps(target->connected.sock) == -1) {
+            close_target(target);
+        }
+    }
+
+    return target->connected.sock;
+}
+
+
+/* find an outstanding call from the XID in a response */
+/* returns NULL for unknown XIDs, usually a late response to a request that has already timed out */
+static struct async_call *find_call(struct async_engine *engine, uint32_t xid) {
+    unsigned long slot = xid & ((1UL << engine->slot_bits) - 1);
+
+    struct async_call *call;
+
+    if (slot < engine->slots) {
+        call = &engine->chunks[slot / ASYNC_CHUNK][slot % ASYNC_CHUNK];
+
+        if (call->index >= 0 && call->xid == xid) {
+            return call;
+        }
+    }
+
+    return NULL;
+}
+
+
+/* encode a NULL request into buf */
+/* this is only done once, each request is a copy with its own XID */
+/* returns the length of the request or 0 on error */
+static u_int encode_null(char *buf, u_int len, uint32_t xid, unsigned long prognum, unsigned long version) {
+    XDR xdrs;
+    struct rpc_msg call = {
+        .rm_xid = xid,
+        .rm_direction = CALL,
+    };
+    u_int pos = 0;
+
+    call.rm_call.cb_rpcvers = RPC_MSG_VERSION;
+    call.rm_call.cb_prog = prognum;
+    call.rm_call.cb_vers = version;
+    call.rm_call.cb_proc = NULLPROC;
+    /* AUTH_NONE */
+    call.rm_call.cb_cred = _null_auth;
+    call.rm_call.cb_verf = _null_auth;
+
+    xdrmem_create(&xdrs, buf, len, XDR_ENCODE);
+
+    /* NULL procedures don't have any arguments so the call header is the whole request */
+    if (xdr_callmsg(&xdrs, &call)) {
+        pos = xdr_getpos(&xdrs);
+    }
+
+    xdr_destroy(&xdrs);
+
+    return pos;
+}
+
+
+/* the XID is the first word of every RPC message */
+static void set_xid(char *buf, uint32_t xid) {
+    xid = htonl(xid);
+    memcpy(buf, &xid, sizeof(xid));
+}
+
+
+/* get the XDR word at offset in a message */
+static uint32_t get_word(const char *buf, size_t offset) {
+    uint32_t word;
+
+    memcpy(&word, buf + offset, sizeof(word));
+
+    return ntohl(word);
+}
+
+
+/* decode a reply to a NULL request */
+/* NULL procedures don't return anything so instead of going through xdr_replymsg() */
+/* just pick out the XID, reply_stat and accept_stat (or reject_stat) */
+/* returns the RPC status from the server and sets xid */
+/* returns RPC_CANTDECODERES for garbage */
+static enum clnt_stat decode_null(const char *buf, size_t len, uint32_t *xid) {
+    size_t offset;
+    uint32_t verf_len;
+
+    /* xid, msg_type, reply_stat */
+    if (len < 3 * BYTES_PER_XDR_UNIT || get_word(buf, 4) != REPLY) {
+        return RPC_CANTDECODERES;
+    }
+
+    *xid = get_word(buf, 0);
+
+    switch (get_word(buf, 8)) {
+        case MSG_ACCEPTED:
+            /* skip over the verifier's flavour, length and body to get to accept_stat */
+            if (len < 5 * BYTES_PER_XDR_UNIT) {
+                return RPC_CANTDECODERES;
+            }
+
+            verf_len = get_word(buf, 16);
+            if (verf_len > MAX_AUTH_BYTES) {
+                return RPC_CANTDECODERES;
+            }
+
+            offset = 5 * BYTES_PER_XDR_UNIT + RNDUP(verf_len);
+            if (len < offset + BYTES_PER_XDR_UNIT) {
+                return RPC_CANTDECODERES;
+            }
+
+            switch (get_word(buf, offset)) {
+                case SUCCESS:
+                    return RPC_SUCCESS;
+                case PROG_UNAVAIL:
+                    return RPC_PROGUNAVAIL;
+                case PROG_MISMATCH:
+                    return RPC_PROGVERSMISMATCH;
+                case PROC_UNAVAIL:
+                    return RPC_PROCUNAVAIL;
+                case GARBAGE_ARGS:
+                    return RPC_CANTDECODEARGS;
+                case SYSTEM_ERR:
+                default:
+                    return RPC_SYSTEMERROR;
+            }
+        case MSG_DENIED:
+            if (len < 4 * BYTES_PER_XDR_UNIT) {
+                return RPC_CANTDECODERES;
+            }
+
+            if (get_word(buf, 12) == RPC_MISMATCH) {
+                return RPC_VERSMISMATCH;
+            } else {
+                return RPC_AUTHERROR;
+            }
+        default:
+            return RPC_CANTDECODERES;
+    }
+}
+
+
+/* finish a call and fill in the result */
+/* rx_stamp is the kernel's receive timestamp for the response, or NULL */
+static void complete_call(struct async_engine *engine, struct async_call *call, enum clnt_stat status, int error, const struct timespec *now, const struct timespec *rx_stamp, struct async_result *result) {
+    struct async_target *target = &engine->targets[call->index];
+    struct timespec elapsed;
+
+    result->target = target->target;
+    result->index = call->index;
+    result->seq = call->seq;
+    result->status = status;
+    result->error = error;
+    result->wall_clock = call->wall_clock;
+
+    timespecsub(now, &call->sent, &elapsed);
+    result->us = ts2us(elapsed);
+
+    /* the kernel timestamps are wall clock time so check they haven't gone backwards */
+    result->wire = 0;
+    if (rx_stamp && timespecisset(rx_stamp) && timespecisset(&call->tx_stamp) && !timespeccmp(rx_stamp, &call->tx_stamp, <)) {
+        timespecsub(rx_stamp, &call->tx_stamp, &elapsed);
+        result->wire = 1;
+        result->wire_us = ts2us(elapsed);
+    }
+
+    inflight_remove(engine, call);
+
+    /* reconnect for the next request once there's nothing else in flight on this socket, or if the socket has an error */
+    /* a timeout is just a lost datagram, closing the socket then would lose the replies to everything else in flight */
+    if ((engine->reconnect && target->outstanding == 0) || status == RPC_CANTSEND || status == RPC_CANTRECV) {
+        close_target(target);
+    }
+}
+
+
+/* find the oldest call in flight to a target */
+/* only used for socket errors so a linear search is fine */
+static struct async_call *oldest_call(struct async_engine *engine, struct async_target *target) {
+    struct async_call *call;
+    long index = target - engine->targets;
+
+    for (call = engine->oldest; call; call = call->next) {
+        if (call->index == index) {
+            return call;
+        }
+    }
+
+    return NULL;
+}
+
+
+/* read the transmit timestamps for requests on a socket from its error queue */
+/* the kernel queues these once the request has been handed to the network device */
+/* timestamps for requests that have already completed or been overwritten in the ring are ignored */
+static void read_timestamps(struct async_engine *engine, struct async_socket *socket) {
+    char control[ASYNC_CONTROL];
+    struct msghdr msg;
+    struct cmsghdr *cmsg;
+    struct scm_timestamping stamps;
+    struct sock_extended_err err;
+    struct async_call *call;
+    int have_stamps, have_err;
+
+    while (socket->sock >= 0 && socket->tx) {
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        engine->stats.syscalls++;
+        if (recvmsg(socket->sock, &msg, MSG_ERRQUEUE) < 0) {
+            break;
+        }
+
+        have_stamps = have_err = 0;
+
+        for (cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPING) {
+                memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+                have_stamps = 1;
+            } else if (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) {
+                memcpy(&err, CMSG_DATA(cmsg), sizeof(err));
+                have_err = 1;
+            }
+        }
+
+        if (!have_stamps || !have_err || err.ee_errno != ENOMSG || err.ee_origin != SO_EE_ORIGIN_TIMESTAMPING) {
+            continue;
+        }
+
+        /* ee_data is the request's key */
+        call = socket->tx[err.ee_data % socket->tx_size];
+
+        /* software timestamps are in the first slot */
+        if (call && call->index >= 0 && call->socket == socket && call->tskey == err.ee_data) {
+            call->tx_stamp = stamps.ts[0];
+        }
+    }
+}
+
+
+/* match a response to its request and complete the call */
+/* returns 1 if the result has been filled in, or 0 if the response was discarded */
+static int read_response(struct async_engine *engine, struct async_socket *socket, struct msghdr *msg, size_t len, const struct timespec *now, struct async_result *result) {
+    struct async_target *target;
+    struct async_call *call;
+    struct sockaddr_in *from = msg->msg_name;
+    struct cmsghdr *cmsg;
+    struct scm_timestamping stamps;
+    const struct timespec *rx_stamp = NULL;
+    uint32_t xid;
+    enum clnt_stat status;
+
+    /* the receive timestamp */
+    if (msg->msg_controllen) {
+        for (cmsg = CMSG_FIRSTHDR(msg); cmsg; cmsg = CMSG_NXTHDR(msg, cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPING) {
+                memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+                rx_stamp = &stamps.ts[0];
+            }
+        }
+    }
+
+    status = decode_null(msg->msg_iov->iov_base, len, &xid);
+
+    if (status == RPC_CANTDECODERES) {
+        debug("async: couldn't decode response\n");
+        return 0;
+    }
+
+    call = find_call(engine, xid);
+
+    if (call == NULL) {
+        debug("async: discarding response with unknown xid %u\n", xid);
+        return 0;
+    }
+
+    target = &engine->targets[call->index];
+
+    /* make sure the response came from the target we sent the request to */
+    if (socket->target) {
+        if (socket->target != target) {
+            debug("async: discarding response with xid %u on the wrong socket\n", xid);
+            return 0;
+        }
+    } else if (from->sin_addr.s_addr != target->target->client_sock->sin_addr.s_addr || from->sin_port != target->target->client_sock->sin_port) {
+        debug("async: discarding response with xid %u from the wrong address\n", xid);
+        return 0;
+    }
+
+    complete_call(engine, call, status, 0, now, rx_stamp, result);
+    engine->stats.responses++;
+
+    return 1;
+}
+
+
+/* read all of the waiting responses on a socket */
+/* responses are read in batches with recvmmsg() */
+/* epoll is level triggered so if we run out of results the rest will be read next time */
+/* returns the number of results */
+static int read_responses(struct async_engine *engine, struct async_socket *socket, const struct timespec *now, struct async_result *results, int max) {
+    struct async_recv *recv = engine->recv;
+    struct async_call *call;
+    struct msghdr *msg;
+    unsigned int vlen, i;
+    int received;
+    int done = 0;
+
+    /* get the transmit timestamps first so they're there for any responses */
+    if (engine->timestamps) {
+        read_timestamps(engine, socket);
+    }
+
+    while (done < max && socket->sock >= 0) {
+        vlen = max - done < ASYNC_BATCH ? max - done : ASYNC_BATCH;
+
+        /* the kernel overwrites the lengths */
+        for (i = 0; i < vlen; i++) {
+            msg = &recv->msgs[i].msg_hdr;
+            msg->msg_namelen = sizeof(recv->from[i]);
+            msg->msg_controllen = engine->timestamps ? sizeof(recv->control[i]) : 0;
+            msg->msg_flags = 0;
+        }
+
+        received = recvmmsg(socket->sock, recv->msgs, vlen, 0, NULL);
+        engine->stats.syscalls++;
+
+        if (received < 0) {
+            /* connected sockets get errors like ECONNREFUSED from an ICMP port unreachable */
+            /* shared sockets don't get these so those targets just time out */
+            if (errno != EAGAIN && errno != EWOULDBLOCK && socket->target && (call = oldest_call(engine, socket->target))) {
+                complete_call(engine, call, RPC_CANTRECV, errno, now, NULL, &results[done]);
+                done++;
+            }
+            break;
+        }
+
+        for (i = 0; i < (unsigned int)received; i++) {
+            done += read_response(engine, socket, &recv->msgs[i].msg_hdr, recv->msgs[i].msg_len, now, &results[done]);
+        }
+
+        /* a short batch means the socket is empty so don't bother asking again */
+        if ((unsigned int)received < vlen) {
+            break;
+        }
+    }
+
+    return done;
+}
+
+
+#ifdef HAVE_IO_URING
+/* io_uring */
+/* requests and receives on shared sockets are queued as SQEs */
+/* then submitting them and waiting for completions is a single io_uring_enter() */
+
+/* number of receives to keep queued on each shared socket */
+#define URING_RECVS 16
+
+/* the top bits of each completion's user_data say what it was for */
+#define URING_SEND (1ULL << 62)
+#define URING_RECV (2ULL << 62)
+#define URING_TYPE (3ULL << 62)
+
+/* a request being sent, the kernel doesn't read this until it's submitted so each call slot has its own */
+struct uring_send {
+    struct msghdr msg;
+    struct iovec iov;
+    char buf[ASYNC_REQUEST];
+};
+
+/* a receive queued on a shared socket */
+struct uring_recv {
+    struct msghdr msg;
+    struct iovec iov;
+    struct sockaddr_in from;
+    char buf[ASYNC_BUFSIZE];
+};
+
+struct async_uring {
+    int fd;
+    /* the submission and completion rings share a mapping, the SQEs have their own */
+    void *rings;
+    size_t rings_size;
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+    unsigned int *sq_head, *sq_tail, *sq_mask, *sq_array;
+    unsigned int sq_entries;
+    unsigned int *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_cqe *cqes;
+    /* SQEs filled in but not given to the kernel yet */
+    unsigned int pending;
+    /* send buffers for each call slot, allocated in chunks of ASYNC_CHUNK like the slots */
+    struct uring_send **sends;
+    unsigned long send_chunks;
+    /* URING_RECVS receives for each shared socket */
+    struct uring_recv *recvs;
+};
+
+
+/* glibc doesn't have wrappers for the io_uring system calls */
+static int uring_setup(unsigned int entries, struct io_uring_params *params) {
+    return syscall(__NR_io_uring_setup, entries, params);
+}
+
+
+static int uring_enter(int fd, unsigned int to_submit, unsigned int min_complete, unsigned int flags, void *arg, size_t size) {
+    return syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, size);
+}
+
+
+/* submit any queued SQEs */
+/* if timeout isn't NULL also wait up to that long for a completion */
+/* returns the result of io_uring_enter(), running out of time is an ETIME error */
+static int uring_submit(struct async_engine *engine, const struct timespec *timeout) {
+    struct async_uring *uring = engine->uring;
+    struct __kernel_timespec ts;
+    struct io_uring_getevents_arg arg = { 0 };
+    unsigned int flags = IORING_ENTER_EXT_ARG;
+    unsigned int to_submit;
+    int ret;
+
+    /* hand the new SQEs to the kernel */
+    __atomic_store_n(uring->sq_tail, *uring->sq_tail + uring->pending, __ATOMIC_RELEASE);
+    uring->pending = 0;
+
+    /* this includes any that didn't get submitted last time */
+    to_submit = *uring->sq_tail - __atomic_load_n(uring->sq_head, __ATOMIC_ACQUIRE);
+
+    if (timeout) {
+        ts.tv_sec = timeout->tv_sec;
+        ts.tv_nsec = timeout->tv_nsec;
+        arg.ts = (uintptr_t)&ts;
+        flags |= IORING_ENTER_GETEVENTS;
+    } else if (to_submit == 0) {
+        return 0;
+    }
+
+    ret = uring_enter(uring->fd, to_submit, timeout ? 1 : 0, flags, &arg, sizeof(arg));
+    engine->stats.syscalls++;
+
+    return ret;
+}
+
+
+/* get the next free SQE */
+/* returns NULL if the submission queue is full and can't be submitted */
+static struct io_uring_sqe *uring_sqe(struct async_engine *engine) {
+    struct async_uring *uring = engine->uring;
+    struct io_uring_sqe *sqe;
+    unsigned int tail = *uring->sq_tail + uring->pending;
+    unsigned int index;
+
+    /* make some room */
+    if (tail - __atomic_load_n(uring->sq_head, __ATOMIC_ACQUIRE) >= uring->sq_entries) {
+        if (uring_submit(engine, NULL) < 0) {
+            perror("uring_sqe(io_uring_enter)");
+        }
+
+        tail = *uring->sq_tail;
+        if (tail - __atomic_load_n(uring->sq_head, __ATOMIC_ACQUIRE) >= uring->sq_entries) {
+            return NULL;
+        }
+    }
+
+    index = tail & *uring->sq_mask;
+    uring->sq_array[index] = index;
+    uring->pending++;
+
+    sqe = &uring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+
+    return sqe;
+}
+
+
+/* queue a receive on a shared socket */
+/* index is the receive's position in the recvs array */
+static void uring_recv(struct async_engine *engine, unsigned long index) {
+    struct uring_recv *recv = &engine->uring->recvs[index];
+    struct io_uring_sqe *sqe = uring_sqe(engine);
+
+    if (sqe == NULL) {
+        debug("async: couldn't queue receive, io_uring is full\n");
+        return;
+    }
+
+    recv->msg.msg_namelen = sizeof(recv->from);
+    recv->msg.msg_flags = 0;
+
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = engine->shared[index / URING_RECVS].sock;
+    sqe->addr = (uintptr_t)&recv->msg;
+    sqe->len = 1;
+    sqe->user_data = URING_RECV | index;
+}
+
+
+/* get the send buffer for a call slot, allocating a chunk of them if needed */
+/* new buffers start with a copy of the request so only the XID needs to be filled in */
+static struct uring_send *uring_buffer(struct async_engine *engine, const struct async_call *call) {
+    struct async_uring *uring = engine->uring;
+    struct uring_send *send;
+    unsigned long chunk = call->slot / ASYNC_CHUNK;
+    unsigned long i;
+
+    if (uring->sends == NULL) {
+        uring->send_chunks = (engine->max_slots + ASYNC_CHUNK - 1) / ASYNC_CHUNK;
+        uring->sends = calloc(uring->send_chunks, sizeof(struct uring_send *));
+        if (uring->sends == NULL) {
+            fatalx(3, "Couldn't allocate memory for requests!\n");
+        }
+    }
+
+    if (uring->sends[chunk] == NULL) {
+        uring->sends[chunk] = calloc(ASYNC_CHUNK, sizeof(struct uring_send));
+        if (uring->sends[chunk] == NULL) {
+            fatalx(3, "Couldn't allocate memory for requests!\n");
+        }
+
+        for (i = 0; i < ASYNC_CHUNK; i++) {
+            send = &uring->sends[chunk][i];
+            memcpy(send->buf, engine->request, engine->request_len);
+            send->iov.iov_base = send->buf;
+            send->iov.iov_len = engine->request_len;
+            send->msg.msg_namelen = sizeof(struct sockaddr_in);
+            send->msg.msg_iov = &send->iov;
+            send->msg.msg_iovlen = 1;
+        }
+    }
+
+    return &uring->sends[chunk][call->slot % ASYNC_CHUNK];
+}
+
+
+/* queue the request in the call slot's send buffer */
+/* returns 0 or -1 if the submission queue is full */
+static int uring_send(struct async_engine *engine, struct async_target *target, struct async_call *call) {
+    struct uring_send *send = uring_buffer(engine, call);
+    struct io_uring_sqe *sqe = uring_sqe(engine);
+
+    if (sqe == NULL) {
+        errno = EBUSY;
+        return -1;
+    }
+
+    send->msg.msg_name = target->target->client_sock;
+
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = target->shared->sock;
+    sqe->addr = (uintptr_t)&send->msg;
+    sqe->len = 1;
+    /* successful sends aren't interesting */
+    sqe->user_data = URING_SEND | call->xid;
+
+    return 0;
+}
+
+
+/* submit any queued requests and receives and wait until next for completions */
+/* if next is NULL just check for completions without waiting */
+/* updates now after waiting */
+/* returns the number of results or -1 on error */
+static int wait_uring(struct async_engine *engine, const struct timespec *next, struct timespec *now, struct async_result *results, int max) {
+    struct async_uring *uring = engine->uring;
+    struct io_uring_cqe *cqe;
+    struct async_call *call;
+    struct timespec timeout;
+    unsigned int head, tail;
+    unsigned long index;
+    int done = 0;
+
+    if (next && timespeccmp(next, now, >)) {
+        timespecsub(next, now, &timeout);
+    } else {
+        next = NULL;
+    }
+
+    if (uring_submit(engine, next ? &timeout : NULL) < 0 && errno != ETIME) {
+        if (errno != EINTR) {
+            perror("async_run(io_uring_enter)");
+        }
+        return -1;
+    }
+
+    async_clock(now);
+
+    head = *uring->cq_head;
+    tail = __atomic_load_n(uring->cq_tail, __ATOMIC_ACQUIRE);
+
+    /* anything left over is picked up next time */
+    while (head != tail && done < max) {
+        cqe = &uring->cqes[head & *uring->cq_mask];
+        head++;
+
+        if ((cqe->user_data & URING_TYPE) == URING_SEND) {
+            if (cqe->res < 0 && (call = find_call(engine, cqe->user_data & UINT32_MAX))) {
+                complete_call(engine, call, RPC_CANTSEND, -cqe->res, now, NULL, &results[done]);
+                done++;
+            }
+        } else if ((cqe->user_data & URING_TYPE) == URING_RECV) {
+            index = cqe->user_data & ~URING_TYPE;
+
+            if (cqe->res >= 0) {
+                done += read_response(engine, &engine->shared[index / URING_RECVS], &uring->recvs[index].msg, cqe->res, now, &results[done]);
+            } else {
+                debug("async: receive failed: %s\n", strerror(-cqe->res));
+            }
+
+            /* queue another one in its place */
+            uring_recv(engine, index);
+        }
+    }
+
+    __atomic_store_n(uring->cq_head, head, __ATOMIC_RELEASE);
+
+    return done;
+}
+
+
+/* close the ring and free its buffers */
+static void uring_destroy(struct async_engine *engine) {
+    struct async_uring *uring = engine->uring;
+    unsigned long i;
+
+    munmap(uring->sqes, uring->sqes_size);
+    munmap(uring->rings, uring->rings_size);
+    close(uring->fd);
+
+    for (i = 0; i < uring->send_chunks; i++) {
+        free(uring->sends[i]);
+    }
+
+    free(uring->sends);
+    free(uring->recvs);
+    free(uring);
+    engine->uring = NULL;
+}
+#endif /* HAVE_IO_URING */
+
+
+/* set up the engine for the first count targets in a list */
+/* version is the version of the RPC protocol (not the NFS version) */
+/* sockets is the number of shared sockets to send from, or 0 for a connected socket per target */
+struct async_engine *async_init(targets_t *targets, unsigned long count, unsigned long prognum, unsigned long version, struct timeval timeout, struct sockaddr_in src_ip, int reconnect, unsigned int sockets) {
+    int bufsize = ASYNC_SOCKBUF;
+    struct async_engine *engine = calloc(1, sizeof(struct async_engine));
+    struct epoll_event timer_event = {
+        .events = EPOLLIN,
+        .data.ptr = NULL,
+    };
+    targets_t *current;
+    struct async_batch *batch;
+    struct msghdr *msg;
+    unsigned long i, j;
+
+    engine->prognum = prognum;
+    engine->version = version;
+    engine->timeout = timeout;
+    engine->src_ip = src_ip;
+    engine->reconnect = reconnect;
+    engine->count = count;
+    engine->timestamp_sock = -1;
+
+    /* the XID is filled in for each request */
+    engine->request_len = encode_null(engine->request, sizeof(engine->request), 0, prognum, version);
+    if (engine->request_len == 0) {
+        fatalx(3, "Couldn't encode request!\n");
+    }
+
+    engine->targets = calloc(engine->count, sizeof(struct async_target));
+    if (engine->targets == NULL) {
+        fatalx(3, "Couldn't allocate memory for targets!\n");
+    }
+
+    for (i = 0, current = targets; i < count && current; i++, current = current->next) {
+        engine->targets[i].target = current;
+        engine->targets[i].connected.sock = -1;
+        engine->targets[i].connected.target = &engine->targets[i];
+    }
+
+    /* the buffers for each response don't change */
+    engine->recv = calloc(1, sizeof(struct async_recv));
+    if (engine->recv == NULL) {
+        fatalx(3, "Couldn't allocate memory for responses!\n");
+    }
+
+    for (i = 0; i < ASYNC_BATCH; i++) {
+        engine->recv->iovs[i].iov_base = engine->recv->bufs[i];
+        engine->recv->iovs[i].iov_len = sizeof(engine->recv->bufs[i]);
+        msg = &engine->recv->msgs[i].msg_hdr;
+        msg->msg_name = &engine->recv->from[i];
+        msg->msg_iov = &engine->recv->iovs[i];
+        msg->msg_iovlen = 1;
+        msg->msg_control = engine->recv->control[i];
+    }
+
+    engine->epoll_fd = epoll_create1(0);
+    if (engine->epoll_fd == -1) {
+        perror("async_init(epoll_create1)");
+        fatalx(3, "Couldn't initialise epoll!\n");
+    }
+
+    /* the timer is registered with epoll without a socket */
+    engine->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+    if (engine->timer_fd == -1 || epoll_ctl(engine->epoll_fd, EPOLL_CTL_ADD, engine->timer_fd, &timer_event) == -1) {
+        perror("async_init(timerfd)");
+        fatalx(3, "Couldn't create timer!\n");
+    }
+
+    /* a few unconnected sockets instead of one for each target */
+    if (sockets) {
+        engine->shared = calloc(sockets, sizeof(struct async_socket));
+        if (engine->shared == NULL) {
+            fatalx(3, "Couldn't allocate memory for sockets!\n");
+        }
+        engine->shared_count = sockets;
+
+        for (i = 0; i < sockets; i++) {
+            engine->shared[i].sock = create_rpc_socket(NULL, SOCK_DGRAM, src_ip);
+            if (engine->shared[i].sock < 0 || watch_socket(engine, &engine->shared[i]) == -1) {
+                fatalx(3, "Couldn't create shared socket!\n");
+            }
+
+            /* best effort, the default buffers are fine for smaller numbers of targets */
+            setsockopt(engine->shared[i].sock, SOL_SOCKET, SO_RCVBUF, &bufsize, sizeof(bufsize));
+            setsockopt(engine->shared[i].sock, SOL_SOCKET, SO_SNDBUF, &bufsize, sizeof(bufsize));
+
+            /* requests on shared sockets are sent in batches */
+            batch = calloc(1, sizeof(struct async_batch));
+            if (batch == NULL) {
+                fatalx(3, "Couldn't allocate memory for sockets!\n");
+            }
+
+            for (j = 0; j < ASYNC_BATCH; j++) {
+                memcpy(batch->bufs[j], engine->request, engine->request_len);
+                batch->iovs[j].iov_base = batch->bufs[j];
+                batch->iovs[j].iov_len = engine->request_len;
+                batch->msgs[j].msg_hdr.msg_iov = &batch->iovs[j];
+                batch->msgs[j].msg_hdr.msg_iovlen = 1;
+                batch->msgs[j].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+            }
+
+            engine->shared[i].batch = batch;
+        }
+
+        /* spread the targets across the sockets */
+        for (i = 0; i < engine->count; i++) {
+            engine->targets[i].shared = &engine->shared[i % sockets];
+        }
+    }
+
+    return engine;
+}
+
+
+/* time requests with kernel timestamps as well as the usual timer */
+/* call after async_init() and before async_start() */
+/* returns 0 or -1 if the sockets don't support timestamps */
+int async_timestamps(struct async_engine *engine) {
+    unsigned int i;
+
+    engine->timestamps = 1;
+
+    /* connected sockets are set up as they're opened */
+    /* the kernel stops timestamping received packets once no sockets want them, and takes a while to start again */
+    /* so without this the response to a request on a new socket could miss out */
+    if (engine->shared_count == 0) {
+        engine->timestamp_sock = socket(AF_INET, SOCK_DGRAM, 0);
+        if (engine->timestamp_sock == -1) {
+            perror("async_timestamps(socket)");
+            return -1;
+        }
+
+        if (enable_timestamps(engine->timestamp_sock) == -1) {
+            return -1;
+        }
+    }
+
+    for (i = 0; i < engine->shared_count; i++) {
+        engine->shared[i].tx_size = ASYNC_TX_RING;
+        engine->shared[i].tx = calloc(engine->shared[i].tx_size, sizeof(struct async_call *));
+        if (engine->shared[i].tx == NULL) {
+            fatalx(3, "Couldn't allocate memory for timestamps!\n");
+        }
+
+        if (enable_timestamps(engine->shared[i].sock) == -1) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+
+/* send and receive with io_uring instead of epoll */
+/* this only works with shared sockets */
+/* call after async_init() and before async_start() */
+/* returns 0 or -1 if io_uring isn't available */
+int async_uring(struct async_engine *engine) {
+#ifdef HAVE_IO_URING
+    struct io_uring_params params = { 0 };
+    struct async_uring *uring;
+    struct uring_recv *recv;
+    size_t sq_size, cq_size;
+    unsigned long i;
+
+    if (engine->shared_count == 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    uring = calloc(1, sizeof(struct async_uring));
+    if (uring == NULL) {
+        fatalx(3, "Couldn't allocate memory for io_uring!\n");
+    }
+
+    /* room for a batch of requests as well as all of the receives */
+    uring->fd = uring_setup(ASYNC_BATCH + engine->shared_count * URING_RECVS, &params);
+    if (uring->fd == -1) {
+        perror("async_uring(io_uring_setup)");
+        free(uring);
+        return -1;
+    }
+
+    /* the timeout for io_uring_enter() needs Linux 5.11 */
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !(params.features & IORING_FEAT_EXT_ARG)) {
+        fprintf(stderr, "async_uring: kernel is too old!\n");
+        close(uring->fd);
+        free(uring);
+        errno = ENOSYS;
+        return -1;
+    }
+
+    sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    uring->rings_size = sq_size > cq_size ? sq_size : cq_size;
+    uring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    uring->rings = mmap(NULL, uring->rings_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring->fd, IORING_OFF_SQ_RING);
+    uring->sqes = mmap(NULL, uring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring->fd, IORING_OFF_SQES);
+    if (uring->rings == MAP_FAILED || uring->sqes == MAP_FAILED) {
+        perror("async_uring(mmap)");
+        fatalx(3, "Couldn't map io_uring!\n");
+    }
+
+    uring->sq_head  = (unsigned int *)((char *)uring->rings + params.sq_off.head);
+    uring->sq_tail  = (unsigned int *)((char *)uring->rings + params.sq_off.tail);
+    uring->sq_mask  = (unsigned int *)((char *)uring->rings + params.sq_off.ring_mask);
+    uring->sq_array = (unsigned int *)((char *)uring->rings + params.sq_off.array);
+    uring->sq_entries = params.sq_entries;
+    uring->cq_head  = (unsigned int *)((char *)uring->rings + params.cq_off.head);
+    uring->cq_tail  = (unsigned int *)((char *)uring->rings + params.cq_off.tail);
+    uring->cq_mask  = (unsigned int *)((char *)uring->rings + params.cq_off.ring_mask);
+    uring->cqes     = (struct io_uring_cqe *)((char *)uring->rings + params.cq_off.cqes);
+
+    uring->recvs = calloc(engine->shared_count * URING_RECVS, sizeof(struct uring_recv));
+    if (uring->recvs == NULL) {
+        fatalx(3, "Couldn't allocate memory for io_uring!\n");
+    }
+
+    engine->uring = uring;
+
+    /* io_uring does its own waiting for data so the sockets can block */
+    /* otherwise the receives would fail straight away with EAGAIN */
+    for (i = 0; i < engine->shared_count; i++) {
+        fcntl(engine->shared[i].sock, F_SETFL, fcntl(engine->shared[i].sock, F_GETFL) & ~O_NONBLOCK);
+    }
+
+    /* these are submitted along with the first requests */
+    for (i = 0; i < engine->shared_count * URING_RECVS; i++) {
+        recv = &uring->recvs[i];
+        recv->iov.iov_base = recv->buf;
+        recv->iov.iov_len = sizeof(recv->buf);
+        recv->msg.msg_name = &recv->from;
+        recv->msg.msg_iov = &recv->iov;
+        recv->msg.msg_iovlen = 1;
+        uring_recv(engine, i);
+    }
+
+    return 0;
+#else
+    (void)engine;
+    errno = ENOSYS;
+    return -1;
+#endif /* HAVE_IO_URING */
+}
+
+
+/* check if a schedule entry is due before another */
+static inline int due_before(const struct async_due *a, const struct async_due *b) {
+    return timespeccmp(&a->next, &b->next, <);
+}
+
+
+/* move the target at position i in the schedule down until it's in order */
+static void schedule_down(struct async_engine *engine, unsigned long i) {
+    struct async_due *heap = engine->heap;
+    struct async_due tmp;
+    unsigned long child;
+
+    for (;;) {
+        child = 2 * i + 1;
+
+        if (child >= engine->heap_size) {
+            break;
+        }
+
+        /* pick the child that's due first */
+        if (child + 1 < engine->heap_size && due_before(&heap[child + 1], &heap[child])) {
+            child++;
+        }
+
+        if (!due_before(&heap[child], &heap[i])) {
+            break;
+        }
+
+        tmp = heap[i];
+        heap[i] = heap[child];
+        heap[child] = tmp;
+        i = child;
+    }
+}
+
+
+/* start sending requests to every target */
+/* period is the time between requests for targets that don't have their own frequency */
+/* requests is the number of requests to send to each target, or 0 to keep going until we're stopped */
+/* spin is how long to busy-wait before each request is due, or zero to just sleep */
+/* requests due within batch of the first one are sent with it, so they can share a sendmmsg() on shared sockets */
+void async_start(struct async_engine *engine, struct timespec period, unsigned long requests, struct timespec spin, struct timespec batch) {
+    unsigned long long timeout_ns = tv2us(engine->timeout) * 1000ULL;
+    unsigned long long period_ns, offset_ns;
+    struct async_target *target;
+    struct timespec now, offset;
+    unsigned long i;
+
+    engine->requests = requests;
+    engine->unsent = requests * engine->count;
+    engine->spin = spin;
+    engine->batch = batch;
+
+    if (hdr_init(1, ASYNC_MAX_JITTER, 3, &engine->jitter)) {
+        fatalx(3, "Couldn't allocate memory for histogram!\n");
+    }
+
+    engine->heap = calloc(engine->count, sizeof(struct async_due));
+    if (engine->heap == NULL) {
+        fatalx(3, "Couldn't allocate memory for schedule!\n");
+    }
+
+    async_clock(&now);
+
+    for (i = 0; i < engine->count; i++) {
+        target = &engine->targets[i];
+
+        /* per-target frequency */
+        if (target->target->period.tv_sec || target->target->period.tv_nsec) {
+            target->period = target->target->period;
+        } else {
+            target->period = period;
+        }
+        period_ns = ts2ns(target->period);
+
+        /* enough call slots for requests to keep going out on schedule while the earlier ones time out */
+        /* plus one for the request that goes out just before the oldest one times out, and one for luck */
+        target->window = timeout_ns / period_ns + 2;
+        engine->max_slots += target->window;
+
+        /* a connected socket can't have more requests waiting for transmit timestamps than are in flight */
+        if (engine->timestamps && target->shared == NULL) {
+            target->connected.tx_size = target->window;
+            target->connected.tx = calloc(target->connected.tx_size, sizeof(struct async_call *));
+            if (target->connected.tx == NULL) {
+                fatalx(3, "Couldn't allocate memory for timestamps!\n");
+            }
+        }
+
+        /* spread the targets evenly over their periods so the requests don't all go out in a burst */
+        offset_ns = period_ns * i / engine->count;
+        offset.tv_sec = offset_ns / 1000000000;
+        offset.tv_nsec = offset_ns % 1000000000;
+        timespecadd(&now, &offset, &engine->heap[i].next);
+        engine->heap[i].index = i;
+    }
+
+    engine->heap_size = engine->count;
+
+    for (i = engine->heap_size / 2; i-- > 0;) {
+        schedule_down(engine, i);
+    }
+
+    /* usually only a fraction of these will ever be in flight so allocate them as they're needed */
+    engine->chunks = calloc((engine->max_slots + ASYNC_CHUNK - 1) / ASYNC_CHUNK, sizeof(struct async_call *));
+    if (engine->chunks == NULL) {
+        fatalx(3, "Couldn't allocate memory for requests!\n");
+    }
+
+    /* reserve enough low bits of the XID to find the call slot */
+    while ((1UL << engine->slot_bits) < engine->max_slots) {
+        engine->slot_bits++;
+    }
+
+    /* start the XIDs somewhere random like libtirpc does */
+    engine->xid_seq = getpid() ^ time(NULL);
+}
+
+
+/* get a free call slot, allocating another chunk of them if we've run out */
+/* returns NULL if all of the slots are in use */
+static struct async_call *get_call(struct async_engine *engine) {
+    struct async_call *chunk;
+    unsigned long i;
+
+    if (engine->free == NULL && engine->slots < engine->max_slots) {
+        chunk = calloc(ASYNC_CHUNK, sizeof(struct async_call));
+        if (chunk == NULL) {
+            fatalx(3, "Couldn't allocate memory for requests!\n");
+        }
+        engine->chunks[engine->slots / ASYNC_CHUNK] = chunk;
+
+        /* put the new slots on the free list, the last chunk may be partly unused */
+        for (i = ASYNC_CHUNK; i-- > 0;) {
+            chunk[i].index = -1;
+            chunk[i].slot = engine->slots + i;
+            if (chunk[i].slot < engine->max_slots) {
+                chunk[i].next = engine->free;
+                engine->free = &chunk[i];
+            }
+        }
+
+        engine->slots += ASYNC_CHUNK;
+    }
+
+    return engine->free;
+}
+
+
+/* put a call in flight */
+static void start_call(struct async_engine *engine, struct async_call *call, unsigned long index, unsigned long seq) {
+    engine->free = call->next;
+    call->index = index;
+    call->seq = seq;
+    engine->targets[index].outstanding++;
+    inflight_append(engine, call);
+    engine->stats.requests++;
+}
+
+
+/* record how late a request was sent compared to the schedule */
+static void record_jitter(struct async_engine *engine, const struct timespec *sent, const struct timespec *scheduled) {
+    struct timespec late;
+
+    /* requests can't go out early but check anyway since the clocks could be different */
+    if (timespeccmp(sent, scheduled, >)) {
+        timespecsub(sent, scheduled, &late);
+        hdr_record_value(engine->jitter, ts2ns(late));
+    } else {
+        hdr_record_value(engine->jitter, 0);
+    }
+}
+
+
+/* the kernel numbers each request sent on a socket so we can match up the transmit timestamp */
+static void expect_timestamp(struct async_socket *socket, struct async_call *call) {
+    call->socket = socket;
+    call->tskey = socket->tskey++;
+    socket->tx[call->tskey % socket->tx_size] = call;
+    timespecclear(&call->tx_stamp);
+}
+
+
+/* send the requests queued on a shared socket with as few calls to sendmmsg() as possible */
+/* they're already in flight, so any that couldn't be sent are completed with an error */
+/* returns the number of results filled in */
+static int flush_batch(struct async_engine *engine, struct async_socket *socket, struct async_result *results) {
+    struct async_batch *batch = socket->batch;
+    struct timespec now, wall_clock;
+    unsigned int i, sent = 0;
+    int ret, error = 0;
+    int done = 0;
+
+    if (batch->count == 0) {
+        return 0;
+    }
+
+    /* the requests all go out together so share the timestamps */
+    clock_gettime(CLOCK_REALTIME, &wall_clock);
+    async_clock(&now);
+
+    /* keep going after a partial send, it only stops early if the socket buffer fills up */
+    while (sent < batch->count) {
+        ret = sendmmsg(socket->sock, &batch->msgs[sent], batch->count - sent, 0);
+        engine->stats.syscalls++;
+
+        if (ret <= 0) {
+            error = errno;
+            break;
+        }
+
+        sent += ret;
+    }
+
+    for (i = 0; i < batch->count; i++) {
+        batch->calls[i]->sent = now;
+        batch->calls[i]->wall_clock = wall_clock;
+
+        if (i < sent) {
+            record_jitter(engine, &now, &batch->scheduled[i]);
+
+            if (engine->timestamps) {
+                expect_timestamp(socket, batch->calls[i]);
+            }
+        } else {
+            complete_call(engine, batch->calls[i], RPC_CANTSEND, error, &now, NULL, &results[done]);
+            done++;
+        }
+    }
+
+    engine->batched -= batch->count;
+    batch->count = 0;
+
+    return done;
+}
+
+
+/* send the next request to a target */
+/* requests to targets on shared sockets are queued to be sent by flush_batch() */
+/* scheduled is when the request was due, for measuring jitter */
+/* returns 0 if the request is in flight or queued, or 1 if it couldn't be sent and the result has been filled in */
+static int send_call(struct async_engine *engine, unsigned long index, const struct timespec *scheduled, struct async_result *result) {
+    struct async_target *target = &engine->targets[index];
+    struct async_call *call = get_call(engine);
+    struct async_batch *batch = NULL;
+    struct msghdr *msg;
+    enum clnt_stat status = RPC_SUCCESS;
+    int error = 0;
+    unsigned long seq;
+    char local[ASYNC_REQUEST];
+    char *buf = local;
+    u_int len = engine->request_len;
+    ssize_t sent;
+    int sock = target->connected.sock;
+
+    /* count this no matter what so the schedule keeps moving if the server isn't listening */
+    seq = target->sent++;
+    if (engine->requests) {
+        engine->unsent--;
+    }
+
+    /* there should always be a free slot unless we've fallen so far behind schedule that nothing has timed out */
+    if (call == NULL || target->outstanding >= target->window) {
+        status = RPC_INPROGRESS;
+    } else if (sock < 0) {
+        sock = open_target(engine, target);
+        if (sock < 0) {
+            status = RPC_CANTSEND;
+        }
+    }
+
+    if (status == RPC_SUCCESS) {
+        call->xid = (engine->xid_seq++ << engine->slot_bits) | call->slot;
+
+#ifdef HAVE_IO_URING
+        /* io_uring reads the request after we've moved on so it needs its own buffer */
+        if (engine->uring) {
+            buf = uring_buffer(engine, call)->buf;
+        } else
+#endif
+        /* the batch buffers already have a copy of the request */
+        if (target->shared) {
+            batch = target->shared->batch;
+            buf = batch->bufs[batch->count];
+        } else {
+            memcpy(local, engine->request, len);
+        }
+
+        set_xid(buf, call->xid);
+    }
+
+    /* shared sockets aren't connected so each message has the address */
+    if (status == RPC_SUCCESS && batch) {
+        msg = &batch->msgs[batch->count].msg_hdr;
+        msg->msg_name = target->target->client_sock;
+        batch->calls[batch->count] = call;
+        batch->scheduled[batch->count] = *scheduled;
+        batch->count++;
+        engine->batched++;
+
+        start_call(engine, call, index, seq);
+
+        return 0;
+    }
+
+    if (status == RPC_SUCCESS) {
+        /* grab the wall clock time for output */
+        /* the call timer is more important so do this first so we're not measuring the time this call takes */
+        clock_gettime(CLOCK_REALTIME, &call->wall_clock);
+        async_clock(&call->sent);
+
+#ifdef HAVE_IO_URING
+        /* goes out with the next io_uring_enter(), which is soon */
+        if (engine->uring) {
+            sent = uring_send(engine, target, call) == 0 ? (ssize_t)len : -1;
+        } else
+#endif
+        {
+            sent = send(sock, buf, len, 0);
+            engine->stats.syscalls++;
+        }
+
+        if (sent != len) {
+            error = errno;
+            status = RPC_CANTSEND;
+            if (target->outstanding == 0) {
+                close_target(target);
+            }
+        }
+    }
+
+    if (status != RPC_SUCCESS) {
+        result->target = target->target;
+        result->index = index;
+        result->seq = seq;
+        result->status = status;
+        result->error = error;
+        result->us = 0;
+        result->wire = 0;
+        clock_gettime(CLOCK_REALTIME, &result->wall_clock);
+
+        return 1;
+    }
+
+    record_jitter(engine, &call->sent, scheduled);
+
+    if (engine->timestamps) {
+        expect_timestamp(&target->connected, call);
+    }
+
+    start_call(engine, call, index, seq);
+
+    return 0;
+}
+
+
+/* wait until next for responses on the sockets registered with epoll */
+/* if next is NULL just check for responses without waiting */
+/* updates now after waiting */
+/* returns the number of results or -1 on error */
+static int wait_epoll(struct async_engine *engine, const struct timespec *next, struct timespec *now, struct async_result *results, int max) {
+    struct epoll_event events[ASYNC_EVENTS];
+    struct itimerspec wait = { { 0 }, { 0 } };
+    uint64_t expirations;
+    int ready, j;
+    int done = 0;
+    int wait_ms = 0;
+
+    /* the epoll_wait() timeout is in milliseconds which isn't good enough for high frequencies so use the timer instead */
+    /* the schedule is absolute so the timer is only ever used for one wait at a time and errors don't add up */
+    if (next && timespeccmp(next, now, >)) {
+        timespecsub(next, now, &wait.it_value);
+
+        engine->stats.syscalls++;
+        if (timerfd_settime(engine->timer_fd, 0, &wait, NULL) == 0) {
+            wait_ms = -1;
+        } else {
+            perror("async_run(timerfd_settime)");
+            /* round up so we don't wake up just before the deadline */
+            wait_ms = (ts2ns(wait.it_value) + 999999) / 1000000;
+        }
+    }
+
+    ready = epoll_wait(engine->epoll_fd, events, ASYNC_EVENTS, wait_ms);
+    engine->stats.syscalls++;
+
+    if (ready == -1) {
+        if (errno != EINTR) {
+            perror("async_run(epoll_wait)");
+        }
+        return -1;
+    }
+
+    async_clock(now);
+
+    for (j = 0; j < ready && done < max; j++) {
+        /* the timer doesn't have a socket */
+        if (events[j].data.ptr == NULL) {
+            /* reset the timer, it's nonblocking so doesn't matter if it's already been read */
+            engine->stats.syscalls++;
+            if (read(engine->timer_fd, &expirations, sizeof(expirations)) == -1 && errno != EAGAIN) {
+                perror("async_run(read)");
+            }
+            continue;
+        }
+
+        done += read_responses(engine, events[j].data.ptr, now, &results[done], max - done);
+    }
+
+    return done;
+}
+
+
+/* send any requests that are due, then wait for responses, timeouts or the next request to be due */
+/* if we've fallen behind schedule the missed requests are all sent straight away instead of shifting the schedule */
+/* so a stalled server (or a slow loop) can't hide the latency that a real client would have seen */
+/* fills in up to max results and returns the number of results */
+/* returns 0 if interrupted by a signal or if there's nothing left to do */
+int async_run(struct async_engine *engine, struct async_result *results, int max) {
+    struct async_target *target;
+    struct async_due *due;
+    struct async_call *call;
+    struct timespec now, deadline, scheduled, horizon;
+    struct timespec next = { 0 };
+    int have_next = 0;
+    unsigned long index;
+    int ready, j;
+    int done = 0;
+
+    async_clock(&now);
+
+    /* busy-wait for a request that's almost due instead of risking oversleeping */
+    if (engine->heap_size && timespecisset(&engine->spin)) {
+        due = &engine->heap[0];
+        timespecadd(&now, &engine->spin, &deadline);
+
+        if (timespeccmp(&due->next, &deadline, <=)) {
+            while (timespeccmp(&now, &due->next, <)) {
+                async_clock(&now);
+            }
+        }
+    }
+
+    /* send everything that's due, and anything that's nearly due if we're batching */
+    timespecadd(&now, &engine->batch, &horizon);
+
+    /* leave room in the results for any queued requests that fail to send */
+    while (done + engine->batched < (unsigned int)max && engine->heap_size) {
+        due = &engine->heap[0];
+
+        if (timespeccmp(&due->next, &horizon, >)) {
+            break;
+        }
+
+        index = due->index;
+        target = &engine->targets[index];
+
+        if (target->shared && target->shared->batch->count == ASYNC_BATCH) {
+            done += flush_batch(engine, target->shared, &results[done]);
+        }
+
+        /* the schedule is fixed, it doesn't depend on when the request actually went out */
+        scheduled = due->next;
+        timespecadd(&due->next, &target->period, &due->next);
+        done += send_call(engine, index, &scheduled, &results[done]);
+
+        /* take the target out of the schedule once it's done */
+        if (engine->requests && target->sent >= engine->requests) {
+            engine->heap[0] = engine->heap[--engine->heap_size];
+        }
+
+        schedule_down(engine, 0);
+    }
+
+    for (j = 0; j < (int)engine->shared_count; j++) {
+        done += flush_batch(engine, &engine->shared[j], &results[done]);
+    }
+
+    /* keep track of when the next request is due, waking up early if we're going to spin */
+    if (engine->heap_size) {
+        timespecsub(&engine->heap[0].next, &engine->spin, &next);
+        have_next = 1;
+    }
+
+    /* or when the oldest request times out, if that's sooner */
+    if (engine->oldest) {
+        call_deadline(engine, engine->oldest, &deadline);
+
+        if (!have_next || timespeccmp(&deadline, &next, <)) {
+            next = deadline;
+            have_next = 1;
+        }
+    }
+
+    /* nothing in flight and nothing left to send */
+    if (!have_next) {
+        return done;
+    }
+
+    /* don't wait if there are already results to return */
+#ifdef HAVE_IO_URING
+    if (engine->uring) {
+        ready = wait_uring(engine, done ? NULL : &next, &now, &results[done], max - done);
+    } else
+#endif
+    {
+        ready = wait_epoll(engine, done ? NULL : &next, &now, &results[done], max - done);
+    }
+
+    if (ready == -1) {
+        return done;
+    }
+
+    done += ready;
+
+    /* now check for any requests that have timed out */
+    while (done < max && engine->oldest) {
+        call = engine->oldest;
+        call_deadline(engine, call, &deadline);
+
+        if (timespeccmp(&now, &deadline, <)) {
+            break;
+        }
+
+        complete_call(engine, call, RPC_TIMEDOUT, 0, &now, NULL, &results[done]);
+        done++;
+    }
+
+    return done;
+}
+
+
+/* check if all of the requests have been sent and completed */
+/* never true if we're sending requests forever */
+int async_finished(const struct async_engine *engine) {
+    return engine->requests && engine->unsent == 0 && engine->outstanding == 0;
+}
+
+
+/* close all of the sockets and free the engine */
+void async_destroy(struct async_engine *engine) {
+    unsigned long i;
+
+    /* cancel any receives before closing their sockets */
+#ifdef HAVE_IO_URING
+    if (engine->uring) {
+        uring_destroy(engine);
+    }
+#endif
+
+    for (i = 0; i < engine->count; i++) {
+        close_target(&engine->targets[i]);
+        free(engine->targets[i].connected.tx);
+    }
+
+    for (i = 0; i < engine->shared_count; i++) {
+        close(engine->shared[i].sock);
+        free(engine->shared[i].tx);
+        free(engine->shared[i].batch);
+    }
+
+    for (i = 0; i < engine->slots / ASYNC_CHUNK; i++) {
+        free(engine->chunks[i]);
+    }
+
+    if (engine->timestamp_sock >= 0) {
+        close(engine->timestamp_sock);
+    }
+
+    close(engine->timer_fd);
+    close(engine->epoll_fd);
+    free(engine->jitter);
+    free(engine->recv);
+    free(engine->shared);
+    free(engine->heap);
+    free(engine->chunks);
+    free(engine->targets);
+    free(engine);
+}
@@ -0,0 +1,183 @@
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include "nfsping.h"
+
+/* maximum number of socket events to handle for each call to epoll_wait() */
+#define ASYNC_EVENTS 64
+
+/* the largest send jitter to record, in nanoseconds */
+#define ASYNC_MAX_JITTER 60000000000LL /* 60 seconds */
+
+/* call slots are allocated in chunks of this many as they're needed */
+#define ASYNC_CHUNK 1024
+
+/* most requests to send or responses to read with each sendmmsg() or recvmmsg() */
+#define ASYNC_BATCH 64
+
+/* space for a NULL request, they're 40 bytes with AUTH_NONE */
+#define ASYNC_REQUEST 64
+
+/* number of requests on a shared socket that can be waiting for their kernel transmit timestamps */
+#define ASYNC_TX_RING 4096
+
+/* a NULL request waiting for a response */
+struct async_call {
+    /* index into the engine's target array, or -1 if this call slot is free */
+    long index;
+    /* the call's slot number, which makes up the low bits of the XID */
+    unsigned long slot;
+    uint32_t xid;
+    /* the target's request number, starting from 0 */
+    unsigned long seq;
+    /* monotonic time the request was sent, for timing and timeouts */
+    struct timespec sent;
+    /* wall clock time of the request for output */
+    struct timespec wall_clock;
+    /* kernel timestamps: the socket the request went out on, its timestamp key on that socket */
+    /* and when the kernel sent it, zero until the transmit timestamp has been read */
+    struct async_socket *socket;
+    uint32_t tskey;
+    struct timespec tx_stamp;
+    /* in flight list, in the order the requests were sent so the oldest times out first */
+    /* free calls are kept in a list using next */
+    struct async_call *prev, *next;
+};
+
+/* a socket registered with epoll */
+struct async_socket {
+    int sock;
+    /* the target a connected socket belongs to, or NULL for a shared socket */
+    struct async_target *target;
+    /* kernel timestamps: the key the kernel will give the next request sent on this socket */
+    /* and the requests waiting for transmit timestamps, indexed by key */
+    uint32_t tskey;
+    struct async_call **tx;
+    unsigned int tx_size;
+    /* requests waiting to be sent together, shared sockets only */
+    struct async_batch *batch;
+};
+
+/* per target state */
+struct async_target {
+    targets_t *target;
+    /* UDP socket connected to the target, sock is -1 when closed */
+    struct async_socket connected;
+    /* send from this shared socket instead, or NULL */
+    struct async_socket *shared;
+    /* number of requests in flight */
+    unsigned int outstanding;
+    /* maximum number of requests in flight */
+    unsigned int window;
+    /* number of requests started */
+    unsigned long sent;
+    /* time between requests */
+    struct timespec period;
+};
+
+/* an entry in the schedule */
+/* the due time is kept with the index so ordering the heap doesn't have to look at the targets */
+struct async_due {
+    /* monotonic time the target's next request is due */
+    struct timespec next;
+    unsigned long index;
+};
+
+/* the result of a request that got a response, timed out or couldn't be sent */
+struct async_result {
+    targets_t *target;
+    /* the target's index in the engine */
+    unsigned long index;
+    /* the target's request number */
+    unsigned long seq;
+    /* RPC_SUCCESS if the server responded */
+    enum clnt_stat status;
+    /* errno for socket errors */
+    int error;
+    /* start time of the request */
+    struct timespec wall_clock;
+    /* round trip time */
+    unsigned long us;
+    /* round trip time between the kernel sending the request and receiving the response */
+    /* only set if wire is true, which needs kernel timestamps */
+    int wire;
+    unsigned long wire_us;
+};
+
+/* counters for checking how many system calls each request costs (nfsping -v) */
+struct async_stats {
+    unsigned long requests;
+    unsigned long responses;
+    /* sends, receives, waits and timers */
+    unsigned long syscalls;
+    /* connected sockets opened, which each take a few more system calls */
+    unsigned long sockets;
+};
+
+struct async_engine {
+    int epoll_fd;
+    /* the NULL request is the same every time apart from the XID so it's only encoded once */
+    char request[ASYNC_REQUEST];
+    u_int request_len;
+    /* timerfd for waking up when the next request is due, more precise than the epoll_wait() timeout */
+    int timer_fd;
+    unsigned long prognum;
+    unsigned long version;
+    struct timeval timeout;
+    struct sockaddr_in src_ip;
+    /* close sockets after each response (default) */
+    int reconnect;
+    /* ask the kernel for software timestamps on each request and response */
+    int timestamps;
+    /* an idle socket that keeps the kernel's receive timestamps turned on between connected sockets */
+    int timestamp_sock;
+    /* unconnected sockets shared between all targets */
+    struct async_socket *shared;
+    unsigned int shared_count;
+    /* targets */
+    struct async_target *targets;
+    unsigned long count;
+    /* number of requests to send to each target, 0 = forever */
+    unsigned long requests;
+    /* requests left to send to all targets */
+    unsigned long unsent;
+    /* the schedule, a binary min-heap of targets ordered by when their next request is due */
+    /* targets are removed once they've sent all of their requests */
+    struct async_due *heap;
+    unsigned long heap_size;
+    /* busy-wait for this long before each request is due instead of sleeping */
+    struct timespec spin;
+    /* send requests that are due within this long of each other together */
+    struct timespec batch;
+    /* how late each request was sent compared to the schedule, in nanoseconds */
+    struct hdr_histogram *jitter;
+    /* call slots, allocated in chunks of ASYNC_CHUNK as they're needed up to a window per target */
+    struct async_call **chunks;
+    unsigned long slots;
+    unsigned long max_slots;
+    struct async_call *free;
+    /* the low bits of each XID are the call slot */
+    unsigned int slot_bits;
+    /* high bits of the XID, incremented for each request */
+    uint32_t xid_seq;
+    /* the in flight list */
+    struct async_call *oldest, *newest;
+    unsigned long outstanding;
+    /* requests queued on shared sockets but not sent yet */
+    unsigned int batched;
+    /* buffers for recvmmsg() */
+    struct async_recv *recv;
+    /* send and receive with io_uring instead of epoll, or NULL */
+    struct async_uring *uring;
+    struct async_stats stats;
+};
+
+struct async_engine *async_init(targets_t *, unsigned long, unsigned long, unsigned long, struct timeval, struct sockaddr_in, int, unsigned int);
+int async_timestamps(struct async_engine *);
+int async_uring(struct async_engine *);
+void async_start(struct async_engine *, struct timespec, unsigned long, struct timespec, struct timespec);
+int async_run(struct async_engine *, struct async_result *, int);
+int async_finished(const struct async_engine *);
+void async_destroy(struct async_engine *);
+
+#endif /* ASYNC_H */
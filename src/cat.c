@@ -1,28 +1,48 @@
 #include "nfsping.h"
 #include "rpc.h"
 #include "util.h"
+#include "read.h"
 
 /* local prototypes */
 static void usage(void);
 static READ3res *do_read(CLIENT *, nfs_fh_list *, offset3, const unsigned long, unsigned long *);
 static void print_output(enum outputs format, char *prefix, char* host, char* path, count3 count, unsigned long min, unsigned long max, double avg, unsigned long sent, unsigned long received,  const struct timespec now, unsigned long us);
+static int read_window(struct read_engine *, targets_t *, nfs_fh_list *, unsigned long, enum outputs, char *);
+static void print_connections(const struct read_engine *, double);
+static count3 get_blocksize(CLIENT *, targets_t *, nfs_fh_list *, int);
+static void connect_target(targets_t *, nfs_fh_list *, struct addrinfo *, unsigned long, struct timeval, struct sockaddr_in, unsigned long);
+static int get_size(CLIENT *, targets_t *, nfs_fh_list *, size3 *);
+static void read_benchmark(struct read_engine *, targets_t *, nfs_fh_list *, size3, const struct read_random *, unsigned long, unsigned long, enum outputs, char *);
+static void print_interval(enum outputs, char *, const targets_t *, const nfs_fh_list *, struct hdr_histogram *, unsigned long, unsigned long long, double, const struct timespec);
+static int parse_pattern(const char *, struct read_random *);
+
+/* percentiles for random read latencies (-R) */
+static const double bench_percentiles[] = { 50.0, 90.0, 99.0, 99.9 };
+/* and their metric names, without dots for Graphite */
+static const char *bench_names[] = { "p50", "p90", "p99", "p999" };
+#define BENCH_PERCENTILES (sizeof(bench_percentiles) / sizeof(bench_percentiles[0]))
  
 
 /* globals */
 int verbose = 0;
+extern volatile sig_atomic_t quitting;
 
 void usage() {
     printf("Usage: nfscat [options]\n\
-    -b n      blocksize (in bytes, default 8192)\n\
+    -b n      blocksize (in bytes, default from the server)\n\
     -c n      count of read requests to send to target\n\
     -E        StatsD format output (default human readable)\n\
     -g string prefix for Graphite/StatsD metric names (default \"nfsping\")\n\
     -G        Graphite format output (default human readable)\n\
     -h        display this help and exit\n\
     -H n      frequency in Hertz (requests per second, default %i)\n\
+    -n n      number of connections to stripe reads across, reports throughput\n\
+    -Q n      with -R, report every n seconds (default 1)\n\
+    -R dist   random reads benchmark: uniform, zipf[:theta] or hotset[:%%file:%%reads]\n\
     -S addr   set source address\n\
     -T        use TCP (default UDP)\n\
-    -v        verbose output\n",
+    -v        verbose output\n\
+    -w n      number of read requests to keep in flight, reports throughput\n",
     NFS_HERTZ);
 
     exit(3);
@@ -64,6 +84,87 @@ READ3res *do_read(CLIENT *client, nfs_fh_list *dir, offset3 offset, const unsign
 }
 
 
+/* ask the server for its preferred read size with FSINFO */
+/* the filehandle can be any file on the filesystem */
+/* returns rtpref clamped to rtmax, or 0 if the server didn't say */
+count3 get_blocksize(CLIENT *client, targets_t *target, nfs_fh_list *fh, int socktype) {
+    FSINFO3args args = {
+        .fsroot = fh->nfs_fh,
+    };
+    FSINFO3res *res;
+    const char *proc = "nfsproc3_fsinfo_3";
+    struct rpc_err clnt_err;
+    count3 blocksize;
+
+    res = nfsproc3_fsinfo_3(&args, client);
+
+    if (res == NULL) {
+        fprintf(stderr, "%s:%s: ", target->name, fh->path);
+        clnt_perror(client, proc);
+        return 0;
+    }
+
+    if (res->status != NFS3_OK) {
+        fprintf(stderr, "%s:%s: ", target->name, fh->path);
+        clnt_geterr(client, &clnt_err);
+        clnt_err.re_status ? clnt_perror(client, proc) : nfs_perror(res->status, proc);
+        return 0;
+    }
+
+    blocksize = res->FSINFO3res_u.resok.rtpref;
+    if (blocksize == 0 || (res->FSINFO3res_u.resok.rtmax && blocksize > res->FSINFO3res_u.resok.rtmax)) {
+        blocksize = res->FSINFO3res_u.resok.rtmax;
+    }
+
+    /* servers can advertise more than fits in a datagram */
+    if (socktype == SOCK_DGRAM && blocksize > NFS_UDP_BLOCKSIZE) {
+        blocksize = NFS_UDP_BLOCKSIZE;
+    }
+
+    debug("%s: rtpref = %lu, rtmax = %lu, using %lu\n", target->name, res->FSINFO3res_u.resok.rtpref, res->FSINFO3res_u.resok.rtmax, blocksize);
+
+    return blocksize;
+}
+
+
+/* connect to a target the first time one of its files is read */
+/* without a blocksize from the command line, ask the server for one with the first file's filehandle */
+/* then make sure the client's buffers can hold a whole READ reply */
+void connect_target(targets_t *target, nfs_fh_list *fh, struct addrinfo *hints, unsigned long version, struct timeval timeout, struct sockaddr_in src_ip, unsigned long blocksize) {
+    /* the requests are small, the replies carry a block each */
+    u_int recvsz;
+
+    if (blocksize == 0) {
+        target->client = create_rpc_client(target->client_sock, hints, NFS_PROGRAM, version, timeout, src_ip);
+        if (target->client == NULL) {
+            return;
+        }
+
+        blocksize = get_blocksize(target->client, target, fh, hints->ai_socktype);
+        if (blocksize == 0) {
+            blocksize = NFS_BLOCKSIZE;
+        }
+
+        /* reconnect with buffers for the new size */
+        /* the port is kept from the first connection so the portmapper isn't asked again */
+        target->client = destroy_rpc_client(target->client);
+    }
+
+    target->blocksize = blocksize;
+    recvsz = blocksize + READ_REPLY_HEADER;
+
+    target->client = create_rpc_client_bufsize(target->client_sock, hints, NFS_PROGRAM, version, timeout, src_ip, 0, recvsz);
+    if (target->client == NULL) {
+        return;
+    }
+
+    /* don't use default AUTH_NONE */
+    auth_destroy(target->client->cl_auth);
+    /* set up AUTH_SYS */
+    target->client->cl_auth = authunix_create_default();
+}
+
+
 /* Prints to stderr because file contents are printed via stdout */
 void print_output(enum outputs format, char *prefix, char* host, char* path, count3 count, unsigned long min, unsigned long max, double avg, unsigned long sent, unsigned long received,  const struct timespec now, unsigned long us) {
     double loss;
@@ -95,10 +196,348 @@ void print_output(enum outputs format, char *prefix, char* host, char* path, cou
 }
 
 
+/* read a file with a window of requests in flight */
+/* the blocks are written out (or printed with -c) in order as they come back */
+/* then the throughput is printed to stderr */
+/* returns 0, or -1 if the file couldn't be read to the end (or the count) */
+int read_window(struct read_engine *engine, targets_t *target, nfs_fh_list *filehandle, unsigned long count, enum outputs format, char *prefix) {
+    struct read_call *call;
+    int status = 0;
+    struct timespec start, end, elapsed, wall_clock;
+    unsigned long sent = 0, received = 0;
+    unsigned long min = ULONG_MAX, max = 0;
+    double avg = 0;
+    double seconds;
+    unsigned long long bytes = 0;
+    const char *proc = "nfsproc3_read_3";
+
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, &start);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &start);
+#endif
+
+    read_start(engine, filehandle->nfs_fh, 0, count);
+
+    while ((call = read_next(engine))) {
+        sent++;
+
+        if (call->status != RPC_SUCCESS) {
+            fprintf(stderr, "%s:%s: %s: %s\n", target->name, filehandle->path, proc, clnt_sperrno(call->status));
+            status = -1;
+            break;
+        }
+
+        if (call->nfs_status != NFS3_OK) {
+            nfs_perror(call->nfs_status, proc);
+            status = -1;
+            break;
+        }
+
+        received++;
+        bytes += call->len;
+
+        if (call->us < min) min = call->us;
+        if (call->us > max) max = call->us;
+        /* calculate the average time */
+        avg = (avg * (received - 1) + call->us) / received;
+
+        if (count) {
+            clock_gettime(CLOCK_REALTIME, &wall_clock);
+            print_output(format, prefix, target->name, filehandle->path, call->len, min, max, avg, sent, received, wall_clock, call->us);
+        } else if (read_write(engine, call)) {
+            status = -1;
+            break;
+        }
+    }
+
+    fflush(stdout);
+
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, &end);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &end);
+#endif
+    timespecsub(&end, &start, &elapsed);
+    seconds = elapsed.tv_sec + elapsed.tv_nsec / 1e9;
+
+    fprintf(stderr, "%s:%s: %llu bytes in %.3f s = %.2f MB/s (%lu reads, min/avg/max = %.2f/%.2f/%.2f ms)\n",
+        target->name,
+        filehandle->path,
+        bytes,
+        seconds,
+        seconds > 0 ? bytes / seconds / 1000000 : 0,
+        received,
+        received ? min / 1000.0 : 0,
+        avg / 1000.0,
+        max / 1000.0);
+
+    if (engine->connections > 1) {
+        print_connections(engine, seconds);
+    }
+
+    return status;
+}
+
+
+/* print the reads on each connection for the last file to stderr */
+void print_connections(const struct read_engine *engine, double seconds) {
+    const struct read_conn *conn;
+    unsigned int i;
+
+    for (i = 0; i < engine->connections; i++) {
+        conn = &engine->conns[i];
+
+        fprintf(stderr, "    connection %u (port %u): %llu bytes = %.2f MB/s (%lu reads, min/p50/p99/max = %.2f/%.2f/%.2f/%.2f ms)\n",
+            i,
+            conn->port,
+            conn->bytes,
+            seconds > 0 ? conn->bytes / seconds / 1000000 : 0,
+            conn->reads,
+            conn->reads ? hdr_min(conn->histogram) / 1000.0 : 0,
+            hdr_value_at_percentile(conn->histogram, 50) / 1000.0,
+            hdr_value_at_percentile(conn->histogram, 99) / 1000.0,
+            hdr_max(conn->histogram) / 1000.0);
+    }
+}
+
+
+/* get the size of a file with GETATTR for picking random blocks */
+/* returns 0, or -1 on error */
+int get_size(CLIENT *client, targets_t *target, nfs_fh_list *fh, size3 *size) {
+    GETATTR3args args = {
+        .object = fh->nfs_fh,
+    };
+    GETATTR3res *res;
+    const char *proc = "nfsproc3_getattr_3";
+    struct rpc_err clnt_err;
+
+    res = nfsproc3_getattr_3(&args, client);
+
+    if (res == NULL) {
+        fprintf(stderr, "%s:%s: ", target->name, fh->path);
+        clnt_perror(client, proc);
+        return -1;
+    }
+
+    if (res->status != NFS3_OK) {
+        fprintf(stderr, "%s:%s: ", target->name, fh->path);
+        clnt_geterr(client, &clnt_err);
+        clnt_err.re_status ? clnt_perror(client, proc) : nfs_perror(res->status, proc);
+        return -1;
+    }
+
+    *size = res->GETATTR3res_u.resok.obj_attributes.size;
+
+    return 0;
+}
+
+
+/* parse the random read distribution (-R) */
+/* returns 0, or -1 if it isn't valid */
+int parse_pattern(const char *arg, struct read_random *random) {
+    char *end;
+
+    if (strcmp(arg, "uniform") == 0) {
+        random->pattern = read_uniform;
+    } else if (strncmp(arg, "zipf", 4) == 0) {
+        random->pattern = read_zipf;
+        /* the YCSB default */
+        random->theta = 0.99;
+        if (arg[4] == ':') {
+            random->theta = strtod(arg + 5, &end);
+            if (*end || random->theta <= 0 || random->theta >= 1) {
+                return -1;
+            }
+        } else if (arg[4]) {
+            return -1;
+        }
+    } else if (strncmp(arg, "hotset", 6) == 0) {
+        random->pattern = read_hotset;
+        /* 80% of the reads go to 20% of the file */
+        random->hot_blocks = 20;
+        random->hot_reads = 80;
+        if (arg[6] == ':') {
+            random->hot_blocks = strtod(arg + 7, &end);
+            if (*end != ':') {
+                return -1;
+            }
+            random->hot_reads = strtod(end + 1, &end);
+            if (*end || random->hot_blocks <= 0 || random->hot_blocks > 100 || random->hot_reads < 0 || random->hot_reads > 100) {
+                return -1;
+            }
+        } else if (arg[6]) {
+            return -1;
+        }
+        random->hot_blocks /= 100;
+        random->hot_reads /= 100;
+    } else {
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/* print the random reads for an interval, or the totals at the end, to stderr */
+void print_interval(enum outputs format, char *prefix, const targets_t *target, const nfs_fh_list *fh, struct hdr_histogram *histogram, unsigned long timeouts, unsigned long long bytes, double seconds, const struct timespec now) {
+    int64_t values[BENCH_PERCENTILES];
+    unsigned long reads = histogram->total_count;
+    double iops = seconds > 0 ? reads / seconds : 0;
+    double mbps = seconds > 0 ? bytes / seconds / 1000000 : 0;
+    unsigned int i;
+
+    hdr_value_at_percentiles(histogram, bench_percentiles, values, BENCH_PERCENTILES);
+
+    if (format == ping) {
+        fprintf(stderr, "%s:%s: %.0f IOPS %.2f MB/s (%lu reads, %lu timeouts, min/p50/p90/p99/p99.9/max = %.2f/%.2f/%.2f/%.2f/%.2f/%.2f ms)\n",
+            target->name,
+            fh->path,
+            iops,
+            mbps,
+            reads,
+            timeouts,
+            reads ? hdr_min(histogram) / 1000.0 : 0,
+            values[0] / 1000.0,
+            values[1] / 1000.0,
+            values[2] / 1000.0,
+            values[3] / 1000.0,
+            hdr_max(histogram) / 1000.0);
+    }
+    if (format == graphite) {
+        fprintf(stderr, "%s.%s.%s.iops %.0f %li\n", prefix, target->name, fh->path, iops, now.tv_sec);
+        fprintf(stderr, "%s.%s.%s.bytes %.0f %li\n", prefix, target->name, fh->path, seconds > 0 ? bytes / seconds : 0, now.tv_sec);
+        fprintf(stderr, "%s.%s.%s.timeouts %lu %li\n", prefix, target->name, fh->path, timeouts, now.tv_sec);
+        if (reads) {
+            for (i = 0; i < BENCH_PERCENTILES; i++) {
+                fprintf(stderr, "%s.%s.%s.usec.%s %" PRId64 " %li\n", prefix, target->name, fh->path, bench_names[i], values[i], now.tv_sec);
+            }
+            fprintf(stderr, "%s.%s.%s.usec.max %" PRId64 " %li\n", prefix, target->name, fh->path, hdr_max(histogram), now.tv_sec);
+        }
+    }
+    if (format == statsd) {
+        fprintf(stderr, "%s.%s.%s.iops:%.0f|g\n", prefix, target->name, fh->path, iops);
+        fprintf(stderr, "%s.%s.%s.bytes:%.0f|g\n", prefix, target->name, fh->path, seconds > 0 ? bytes / seconds : 0);
+        fprintf(stderr, "%s.%s.%s.timeouts:%lu|c\n", prefix, target->name, fh->path, timeouts);
+        if (reads) {
+            for (i = 0; i < BENCH_PERCENTILES; i++) {
+                fprintf(stderr, "%s.%s.%s.msec.%s:%03.2f|g\n", prefix, target->name, fh->path, bench_names[i], values[i] / 1000.0);
+            }
+            fprintf(stderr, "%s.%s.%s.msec.max:%03.2f|g\n", prefix, target->name, fh->path, hdr_max(histogram) / 1000.0);
+        }
+    }
+    fflush(stderr);
+}
+
+
+/* random reads of a file with a window of requests in flight, like a fio random read job */
+/* runs for count reads, or until interrupted if count is 0 */
+/* prints the IOPS, bandwidth and latency percentiles every interval seconds, then the totals */
+void read_benchmark(struct read_engine *engine, targets_t *target, nfs_fh_list *filehandle, size3 size, const struct read_random *random, unsigned long count, unsigned long interval, enum outputs format, char *prefix) {
+    struct read_call *call;
+    struct timespec start, interval_start, now, elapsed, wall_clock;
+    struct hdr_histogram *total, *current;
+    int64_t values[BENCH_PERCENTILES];
+    unsigned long sent = 0;
+    unsigned long timeouts = 0, interval_timeouts = 0;
+    unsigned long long bytes = 0, interval_bytes = 0;
+    double seconds;
+    const char *proc = "nfsproc3_read_3";
+
+    /* from 1us up to the timeout */
+    if (hdr_init(1, tv2us(engine->timeout), 3, &total) || hdr_init(1, tv2us(engine->timeout), 3, &current)) {
+        fatalx(3, "Couldn't allocate memory for histograms!\n");
+    }
+
+    /* setting up a zipf distribution over a big file takes a moment, don't count it */
+    read_random(engine, filehandle->nfs_fh, size, random);
+
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, &start);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &start);
+#endif
+    interval_start = start;
+
+    while (quitting == 0 && (count == 0 || sent < count)) {
+        call = read_any(engine);
+        sent++;
+
+        /* a lost request is a result, anything else means the file can't be read */
+        if (call->status == RPC_TIMEDOUT) {
+            timeouts++;
+            interval_timeouts++;
+        } else if (call->status != RPC_SUCCESS) {
+            fprintf(stderr, "%s:%s: %s: %s\n", target->name, filehandle->path, proc, clnt_sperrno(call->status));
+            break;
+        } else if (call->nfs_status != NFS3_OK) {
+            nfs_perror(call->nfs_status, proc);
+            break;
+        } else {
+            read_record(total, call);
+            read_record(current, call);
+            bytes += call->len;
+            interval_bytes += call->len;
+        }
+
+#ifdef CLOCK_MONOTONIC_RAW
+        clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+#else
+        clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+        timespecsub(&now, &interval_start, &elapsed);
+
+        if ((unsigned long)elapsed.tv_sec >= interval) {
+            clock_gettime(CLOCK_REALTIME, &wall_clock);
+            print_interval(format, prefix, target, filehandle, current, interval_timeouts, interval_bytes, elapsed.tv_sec + elapsed.tv_nsec / 1e9, wall_clock);
+
+            hdr_reset(current);
+            interval_timeouts = 0;
+            interval_bytes = 0;
+            interval_start = now;
+        }
+    }
+
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+    timespecsub(&now, &start, &elapsed);
+    seconds = elapsed.tv_sec + elapsed.tv_nsec / 1e9;
+
+    /* the totals are only for people */
+    if (format == ping) {
+        hdr_value_at_percentiles(total, bench_percentiles, values, BENCH_PERCENTILES);
+
+        fprintf(stderr, "%s:%s: %" PRId64 " reads in %.3f s = %.0f IOPS %.2f MB/s (%lu timeouts, min/p50/p90/p99/p99.9/max = %.2f/%.2f/%.2f/%.2f/%.2f/%.2f ms)\n",
+            target->name,
+            filehandle->path,
+            total->total_count,
+            seconds,
+            seconds > 0 ? total->total_count / seconds : 0,
+            seconds > 0 ? bytes / seconds / 1000000 : 0,
+            timeouts,
+            total->total_count ? hdr_min(total) / 1000.0 : 0,
+            values[0] / 1000.0,
+            values[1] / 1000.0,
+            values[2] / 1000.0,
+            values[3] / 1000.0,
+            hdr_max(total) / 1000.0);
+
+        if (engine->connections > 1) {
+            print_connections(engine, seconds);
+        }
+    }
+
+    free(total);
+    free(current);
+}
+
+
 int main(int argc, char **argv) {
     int ch;
-    char *input_fh;
-    size_t n = 0; /* for getline() */
+    struct fh_reader input;
     targets_t dummy = { 0 };
     targets_t *targets = &dummy;
     targets_t *current = targets;
@@ -111,13 +550,28 @@ int main(int argc, char **argv) {
     };
     unsigned long version = 3;
     offset3 offset = 0;
-    unsigned long blocksize = 8192;
+    /* 0 = ask the server */
+    unsigned long blocksize = 0;
     unsigned long count = 0;
     struct timespec wall_clock, loop_start, loop_end, loop_elapsed, sleepy;
     struct timespec sleep_time;
     unsigned long hertz = NFS_HERTZ;
+    int paced = 0;
     struct timeval timeout = NFS_TIMEOUT;
     unsigned long us;
+    /* number of requests in flight on each connection, 0 = one at a time with clnt_call() */
+    unsigned long window = 0;
+    unsigned long connections = 1;
+    /* exit with 1 if a file couldn't be read */
+    int failed = 0;
+    /* the engine is set up for each target's blocksize */
+    int windowed = 0;
+    /* random reads benchmark */
+    int benchmark = 0;
+    struct read_random random = { 0 };
+    unsigned long interval = 1;
+    size3 size;
+    struct read_engine *engine = NULL;
     enum outputs format = ping;
     char *prefix = "nfscat";
     unsigned long sent = 0, received = 0;
@@ -129,12 +583,14 @@ int main(int argc, char **argv) {
         .sin_addr = 0
     };
 
-    while ((ch = getopt(argc, argv, "b:c:Eg:GhH:S:Tv")) != -1) {
+    while ((ch = getopt(argc, argv, "b:c:Eg:GhH:n:Q:R:S:Tvw:")) != -1) {
         switch(ch) {
             /* blocksize */
             case 'b':
-                /* TODO this maxes out at 64k for TCP and 8k for UDP */
                 blocksize = strtoul(optarg, NULL, 10); 
+                if (blocksize == 0) {
+                    fatal("Zero blocksize, nothing to do!\n");
+                }
                 break;
             case 'c':
                 count = strtoul(optarg, NULL, 10);
@@ -166,6 +622,28 @@ int main(int argc, char **argv) {
             case 'H':
                 /* TODO check for reasonable values */
                 hertz = strtoul(optarg, NULL, 10);
+                paced = 1;
+                break;
+            /* number of connections */
+            case 'n':
+                connections = strtoul(optarg, NULL, 10);
+                if (connections == 0 || connections > READ_CONNECTIONS_MAX) {
+                    fatal("Connections must be between 1 and %i!\n", READ_CONNECTIONS_MAX);
+                }
+                break;
+            /* interval between benchmark reports */
+            case 'Q':
+                interval = strtoul(optarg, NULL, 10);
+                if (interval == 0) {
+                    fatal("Zero interval!\n");
+                }
+                break;
+            /* random reads */
+            case 'R':
+                if (parse_pattern(optarg, &random)) {
+                    fatal("Invalid distribution: %s\n", optarg);
+                }
+                benchmark = 1;
                 break;
             /* source ip address for packets */
             case 'S':
@@ -181,12 +659,34 @@ int main(int argc, char **argv) {
             case 'v':
                 verbose = 1;
                 break;
+            /* read window */
+            case 'w':
+                window = strtoul(optarg, NULL, 10);
+                if (window == 0 || window > READ_WINDOW_MAX) {
+                    fatal("Window must be between 1 and %i!\n", READ_WINDOW_MAX);
+                }
+                break;
             case 'h':
             default:
                 usage();
         }
     }
 
+    /* the window sends requests as fast as the replies come back */
+    if (window || connections > 1 || benchmark) {
+        if (paced) {
+            fatal("Can't specify -H with -n, -R or -w!\n");
+        }
+
+        windowed = 1;
+    }
+
+    if (benchmark) {
+        /* stop and print the totals on control-c */
+        quitting = 0;
+        signal(SIGINT, sigint_handler);
+    }
+
     /* calculate the sleep_time based on the frequency */
     /* check for a frequency of 1, that's a simple case */
     /* this doesn't support frequencies lower than 1Hz */
@@ -200,99 +700,130 @@ int main(int argc, char **argv) {
     }
 
     /* no arguments, use stdin */
-    while (getline(&input_fh, &n, stdin) != -1) {
-        /* don't allocate space for results */
-        current = parse_fh(targets, input_fh, 0, timeout, 0);
-    }
+    fh_reader_init(&input, stdin);
+    /* read each file as soon as its filehandle arrives instead of waiting for the end of the input */
+    /* so a pipeline starts producing data after the first filehandle instead of the last one */
+    /* don't allocate space for results */
+    while (read_fh(&input, targets, 0, 0, &current) != -1) {
+        /* couldn't parse the filehandle */
+        if (current == NULL) {
+            continue;
+        }
 
-    targets = targets->next;
-    current = targets;
+        /* the filehandle that was just read */
+        filehandle = current->last_filehandle;
 
-    while (current) {
         /* no client connection */
         if (current->client == NULL) {
-            /* connect to server */
-            current->client = create_rpc_client(current->client_sock, &hints, NFS_PROGRAM, version, timeout, src_ip);
-            /* don't use default AUTH_NONE */
-            auth_destroy(current->client->cl_auth);
-            /* set up AUTH_SYS */
-            current->client->cl_auth = authunix_create_default();
+            connect_target(current, filehandle, &hints, version, timeout, src_ip, blocksize);
+        }
+
+        /* the blocksize can be different for each server */
+        if (current->client && windowed && (engine == NULL || engine->blocksize != current->blocksize)) {
+            if (engine) {
+                read_destroy(engine);
+            }
+            /* default to one request in flight on each connection */
+            /* only write the file contents when not counting reads */
+            engine = read_init(current->blocksize, window ? window : 1, connections, timeout, count || benchmark ? -1 : STDOUT_FILENO);
         }
 
-        if (current->client) {
+        if (current->client && engine) {
+            /* open the rest of the connections the first time the target is used */
+            if (read_connect(engine, current, &hints, src_ip)) {
+                failed = 1;
+            } else if (benchmark == 0) {
+                /* a file cut short has to show up in the exit status, stdout can't */
+                if (read_window(engine, current, filehandle, count, format, prefix)) {
+                    failed = 1;
+                }
+            /* the random blocks are picked from the whole file */
+            } else if (get_size(current->client, current, filehandle, &size) == 0) {
+                read_benchmark(engine, current, filehandle, size, &random, count, interval, format, prefix);
+            }
+        } else if (current->client) {
             /* start at the beginning of the file */
             offset = 0;
             sent = received = 0;
 
-            filehandle = current->filehandles;
-
-            while (filehandle) {
-                do {
-                    /* grab the starting time of each loop */
-    #ifdef CLOCK_MONOTONIC_RAW
-                   clock_gettime(CLOCK_MONOTONIC_RAW, &loop_start);
-    #else
-                   clock_gettime(CLOCK_MONOTONIC, &loop_start);
-    #endif
-                    /* grab the wall clock time for output */
-                    /* use the start time of the request */
-                    /* the call_start timer is more important so do this first so we're not measuring the time this call takes */
-                    clock_gettime(CLOCK_REALTIME, &wall_clock);
-
-                    res = do_read(current->client, filehandle, offset, blocksize, &us);
-                    sent++;
-                    if (res && res->status == NFS3_OK) {
-                        received++;
-                        /* TODO the final read could be short and take less time, discard? */
-                        /* what about files that come back in a single RPC? */
-                        if (us < min) min = us;
-                        if (us > max) max = us;
-                        /* calculate the average time */
-                        avg = (avg * (received - 1) + us) / received;
-
-                        if (count) {
-
-                            print_output(format, prefix, current->name, filehandle->path, res->READ3res_u.resok.count, min, max, avg, sent, received, wall_clock, us);
-
-                        } else {
-                            /* write to stdout */
-                            fwrite(res->READ3res_u.resok.data.data_val, 1, res->READ3res_u.resok.data.data_len, stdout);
-                        }
-
-                        offset += res->READ3res_u.resok.count;
+            do {
+                /* grab the starting time of each loop */
+#ifdef CLOCK_MONOTONIC_RAW
+                clock_gettime(CLOCK_MONOTONIC_RAW, &loop_start);
+#else
+                clock_gettime(CLOCK_MONOTONIC, &loop_start);
+#endif
+                /* grab the wall clock time for output */
+                /* use the start time of the request */
+                /* the call_start timer is more important so do this first so we're not measuring the time this call takes */
+                clock_gettime(CLOCK_REALTIME, &wall_clock);
+
+                res = do_read(current->client, filehandle, offset, current->blocksize, &us);
+                sent++;
+                if (res && res->status == NFS3_OK) {
+                    received++;
+                    /* TODO the final read could be short and take less time, discard? */
+                    /* what about files that come back in a single RPC? */
+                    if (us < min) min = us;
+                    if (us > max) max = us;
+                    /* calculate the average time */
+                    avg = (avg * (received - 1) + us) / received;
+
+                    if (count) {
+
+                        print_output(format, prefix, current->name, filehandle->path, res->READ3res_u.resok.count, min, max, avg, sent, received, wall_clock, us);
+
+                    } else {
+                        /* write to stdout */
+                        fwrite(res->READ3res_u.resok.data.data_val, 1, res->READ3res_u.resok.data.data_len, stdout);
                     }
-                    /* check count argument */
-                    if (count && sent >= count) {
-                        break;
+
+                    offset += res->READ3res_u.resok.count;
+                }
+                /* the client reuses its results, free the data before the next call allocates another buffer */
+                /* this leaves the status and eof for the loop condition */
+                if (res) {
+                    xdr_free((xdrproc_t)xdr_READ3res, (char *)res);
+                }
+                /* check count argument */
+                if (count && sent >= count) {
+                    break;
+                } else {
+                    /* sleep between rounds */
+                    /* measure how long the current round took, and subtract that from the sleep time */
+                    /* this tries to ensure that each polling round takes the same time */
+#ifdef CLOCK_MONOTONIC_RAW
+                    clock_gettime(CLOCK_MONOTONIC_RAW, &loop_end);
+#else
+                    clock_gettime(CLOCK_MONOTONIC, &loop_end);
+#endif
+                    timespecsub(&loop_end, &loop_start, &loop_elapsed);
+                    debug("Polling took %lld.%.9lds\n", (long long)loop_elapsed.tv_sec, loop_elapsed.tv_nsec);
+                    /* don't sleep if we went over the sleep_time */
+                    if (timespeccmp(&loop_elapsed, &sleep_time, >)) {
+                       debug("Slow poll, not sleeping\n");
                     } else {
-                        /* sleep between rounds */
-                        /* measure how long the current round took, and subtract that from the sleep time */
-                        /* this tries to ensure that each polling round takes the same time */
-    #ifdef CLOCK_MONOTONIC_RAW
-                        clock_gettime(CLOCK_MONOTONIC_RAW, &loop_end);
-    #else
-                        clock_gettime(CLOCK_MONOTONIC, &loop_end);
-    #endif
-                        timespecsub(&loop_end, &loop_start, &loop_elapsed);
-                        debug("Polling took %lld.%.9lds\n", (long long)loop_elapsed.tv_sec, loop_elapsed.tv_nsec);
-                        /* don't sleep if we went over the sleep_time */
-                        if (timespeccmp(&loop_elapsed, &sleep_time, >)) {
-                           debug("Slow poll, not sleeping\n");
-                        } else {
-                           timespecsub(&sleep_time, &loop_elapsed, &sleepy);
-                           debug("Sleeping for %lld.%.9lds\n", (long long)sleepy.tv_sec, sleepy.tv_nsec);
-                           nanosleep(&sleepy, NULL);
-                        }
+                       timespecsub(&sleep_time, &loop_elapsed, &sleepy);
+                       debug("Sleeping for %lld.%.9lds\n", (long long)sleepy.tv_sec, sleepy.tv_nsec);
+                       nanosleep(&sleepy, NULL);
                     }
-                /* check for errors or end of file */
-                } while (res && res->status == NFS3_OK && res->READ3res_u.resok.eof == 0);
+                }
+            /* check for errors or end of file */
+            } while (res && res->status == NFS3_OK && res->READ3res_u.resok.eof == 0);
 
-                filehandle = filehandle->next;
-            } /* while (filehandle) */
+            /* finish writing each file before waiting for the next filehandle */
+            fflush(stdout);
         }
 
-        current = current->next;
-    } /* while(current) */
+        /* interrupted during a benchmark, don't start on the next file */
+        if (quitting) {
+            break;
+        }
+    }
+
+    if (engine) {
+        read_destroy(engine);
+    }
 
-    return(0);
+    return(failed ? 1 : 0);
 }
@@ -345,14 +345,16 @@ void print_format(enum outputs format, char *prefix, char *ndqf, char *path, FSS
         default:
             fatal("Unsupported format\n");
     }
+
+    /* don't hold on to results while the next filehandle is read */
+    fflush(stdout);
 }
 
 
 int main(int argc, char **argv) {
     int ch;
     char output_prefix[255] = "nfs";
-    char *input_fh = NULL;
-    size_t n = 0; /* for getline() */
+    struct fh_reader input;
     targets_t dummy = { 0 };
     targets_t *current = &dummy;
     targets_t *targets = current;
@@ -537,37 +539,37 @@ int main(int argc, char **argv) {
     }
 
     
-    /* first parse all of the input filehandles into a list  from stdin, one per line
-     * this gives us the longest path so we can lay out the output
-     * TODO only for human readable output, otherwise do it line by line
-     */
-    while (getline(&input_fh, &n, stdin) != -1) {
+    fh_reader_init(&input, stdin);
 
+    /*
+     * Human readable output needs the longest host/path to lay out the columns, so read all of the input
+     * filehandles into a list first. The other formats don't need that, so the first round of requests
+     * is sent as the filehandles arrive.
+     */
+    if (cfg.format == ping) {
         /* don't allocate space for results */
-        current = parse_fh(targets, input_fh, cfg.port, timeout, 0);
+        while (read_fh(&input, targets, cfg.port, 0, &current) != -1) {
 
-        /* save the longest host/paths for display formatting */
-        if (current) {
-            if (strlen(current->filehandles->path) > maxpath) {
-                maxpath = strlen(current->filehandles->path);
-            }
-
-            /* check if we're displaying hostnames or IP addresses */
-            if (cfg.display_ips) {
-                if (strlen(current->ip_address) > maxhost) {
-                    maxhost = strlen(current->ip_address);
+            /* save the longest host/paths for display formatting */
+            if (current) {
+                if (strlen(current->last_filehandle->path) > maxpath) {
+                    maxpath = strlen(current->last_filehandle->path);
                 }
-            } else {
-                if (strlen(current->name) > maxhost) {
-                    maxhost = strlen(current->name);
+
+                /* check if we're displaying hostnames or IP addresses */
+                if (cfg.display_ips) {
+                    if (strlen(current->ip_address) > maxhost) {
+                        maxhost = strlen(current->ip_address);
+                    }
+                } else {
+                    if (strlen(current->name) > maxhost) {
+                        maxhost = strlen(current->name);
+                    }
                 }
             }
         }
     }
 
-    /* set to start of list, skipping first dummy entry */
-    targets = targets->next;
-
     /* 
      * Print the header before sending any RPCs, this means we have to guess about the size of the results
      * but it lets the user know that the program is running. Then we can print the results as they come in
@@ -586,11 +588,8 @@ int main(int argc, char **argv) {
     /* the main loop */
     while(1) {
         /* find the current number of rows in the terminal for printing the header once per screen */
-        ioctl(STDOUT_FILENO, TIOCGWINSZ, &winsz);
-        rows = winsz.ws_row;
-
-        /* reset to start of list */
-        current = targets;
+        /* zero if the output isn't a terminal, like when it's piped to another program */
+        rows = ioctl(STDOUT_FILENO, TIOCGWINSZ, &winsz) == 0 ? winsz.ws_row : 0;
 
 #ifdef CLOCK_MONOTONIC_RAW
         clock_gettime(CLOCK_MONOTONIC_RAW, &loop_start);
@@ -598,7 +597,11 @@ int main(int argc, char **argv) {
         clock_gettime(CLOCK_MONOTONIC, &loop_start);
 #endif 
 
-        while (current) {
+        /* start at the beginning of the list, or the next filehandle from the input */
+        filehandle = NULL;
+
+        /* loop through the filehandles for each target */
+        while ((filehandle = next_fh(&input, targets, cfg.port, 0, &current, filehandle))) {
             /* make a new connection if needed */
             if (current->client == NULL) {
                 current->client = create_rpc_client(current->client_sock, &hints, NFS_PROGRAM, version, timeout, src_ip);
@@ -608,78 +611,66 @@ int main(int argc, char **argv) {
                 current->client->cl_auth = authunix_create_default();
             }
 
-            /* loop through the filehandles for each target */
-
-            filehandle = current->filehandles;
-
-            while (filehandle) {
-
-                /* get the current timestamp */
-                clock_gettime(CLOCK_REALTIME, &wall_clock);
+            /* get the current timestamp */
+            clock_gettime(CLOCK_REALTIME, &wall_clock);
 
 #ifdef CLOCK_MONOTONIC_RAW
-                clock_gettime(CLOCK_MONOTONIC_RAW, &call_start);
+            clock_gettime(CLOCK_MONOTONIC_RAW, &call_start);
 #else  
-                clock_gettime(CLOCK_MONOTONIC, &call_start);
+            clock_gettime(CLOCK_MONOTONIC, &call_start);
 #endif 
-                /* the actual RPC call */
-                fsstatres = get_fsstat(current->client, current->name, filehandle);
-                /* second time marker */
+            /* the actual RPC call */
+            fsstatres = get_fsstat(current->client, current->name, filehandle);
+            /* second time marker */
 #ifdef CLOCK_MONOTONIC_RAW
-                clock_gettime(CLOCK_MONOTONIC_RAW, &call_end);
+            clock_gettime(CLOCK_MONOTONIC_RAW, &call_end);
 #else  
-                clock_gettime(CLOCK_MONOTONIC, &call_end);
+            clock_gettime(CLOCK_MONOTONIC, &call_end);
 #endif
-                df_sent++;
-                filehandle->sent++;
+            df_sent++;
+            filehandle->sent++;
 
-                /* calculate elapsed microseconds */
-                timespecsub(&call_end, &call_start, &call_elapsed);
-                usec = ts2us(call_elapsed);
+            /* calculate elapsed microseconds */
+            timespecsub(&call_end, &call_start, &call_elapsed);
+            usec = ts2us(call_elapsed);
 
-                if (fsstatres && fsstatres->status == NFS3_OK) {
-                    df_ok++;
-                    current->received++;
+            if (fsstatres && fsstatres->status == NFS3_OK) {
+                df_ok++;
+                current->received++;
 
-                    /* print header once per screen like vmstat */
-                    /* TODO maybe a better number than df_ok? What about errors? Or the header line itself? */
-                    if (cfg.one_header == 0 && (df_ok % rows == 0)) {
-                        print_header(maxhost, maxpath, cfg.prefix);
-                    }
+                /* print header once per screen like vmstat */
+                /* TODO maybe a better number than df_ok? What about errors? Or the header line itself? */
+                if (cfg.one_header == 0 && rows && (df_ok % rows == 0)) {
+                    print_header(maxhost, maxpath, cfg.prefix);
+                }
 
-                    if (cfg.format == ping) {
-                        if (cfg.inodes) {
-                            if (cfg.display_ips) {
-                                print_inodes(maxpath, current->ip_address, filehandle->path, fsstatres, usec);
-                            } else {
-                                print_inodes(maxpath, current->name, filehandle->path, fsstatres, usec);
-                            }
+                if (cfg.format == ping) {
+                    if (cfg.inodes) {
+                        if (cfg.display_ips) {
+                            print_inodes(maxpath, current->ip_address, filehandle->path, fsstatres, usec);
                         } else {
-                            /* are we printing ip_addresses or hostnames */
-                            /* TODO move this logic into print_df? But then have to pass in the filehandle struct */
-                            if (cfg.display_ips) {
-                                print_df(maxpath, current->ip_address, filehandle->path, fsstatres, cfg.prefix, usec);
-                            } else {
-                                print_df(maxpath, current->name, filehandle->path, fsstatres, cfg.prefix, usec);
-                            }
+                            print_inodes(maxpath, current->name, filehandle->path, fsstatres, usec);
                         }
                     } else {
-                        print_format(cfg.format, output_prefix, current->ndqf, filehandle->path, fsstatres, usec, wall_clock);
+                        /* are we printing ip_addresses or hostnames */
+                        /* TODO move this logic into print_df? But then have to pass in the filehandle struct */
+                        if (cfg.display_ips) {
+                            print_df(maxpath, current->ip_address, filehandle->path, fsstatres, cfg.prefix, usec);
+                        } else {
+                            print_df(maxpath, current->name, filehandle->path, fsstatres, cfg.prefix, usec);
+                        }
                     }
+                } else {
+                    print_format(cfg.format, output_prefix, current->ndqf, filehandle->path, fsstatres, usec, wall_clock);
                 }
+            }
 
-                /* free the result */
-                xdr_free((xdrproc_t)xdr_FSSTAT3res, (char *)fsstatres);
-
-                /* TODO pause between requests to same target? */
-
-                filehandle = filehandle->next;
-            } /* while(filehandle) */
+            /* free the result */
+            xdr_free((xdrproc_t)xdr_FSSTAT3res, (char *)fsstatres);
 
+            /* TODO pause between requests to same target? */
             /* don't pause between targets */
-
-            current = current->next;
-        } /* while(current) */
+        } /* while (filehandle) */
 
         /* measure how long the current round took, and subtract that from the sleep time */
         /* this keeps us on the polling frequency */
@@ -697,8 +688,8 @@ int main(int argc, char **argv) {
         }
 
         /* only sleep if looping or counting */
-        /* check the count against the first filehandle in the first target */
-        if (cfg.loop || (cfg.count && targets->filehandles->sent < cfg.count)) {
+        /* check the count against the first filehandle in the first target, skipping the dummy entry */
+        if (cfg.loop || (cfg.count && targets->next && targets->next->filehandles->sent < cfg.count)) {
             /* don't sleep if we went over the sleep_time */
             if (timespeccmp(&loop_elapsed, &sleep_time, >)) {
                 debug("Slow poll, not sleeping\n");
@@ -0,0 +1,715 @@
+/*
+ * Merge and query the HdrHistogram interval logs written by nfsping -o
+ */
+
+#include "nfsping.h"
+#include "hdr/src/hdr_histogram_log.h"
+#include <fnmatch.h>
+#include <pthread.h>
+
+/* globals */
+int verbose = 0;
+
+/* number of hash buckets for the merged histograms, this doesn't grow */
+#define HLOG_BUCKETS 65536
+
+/* the buckets share this many locks so the threads can merge into different buckets at the same time */
+#define HLOG_LOCKS 256
+
+/* maximum number of percentiles to print */
+#define HLOG_PERCENTILES 16
+
+/* maximum number of target patterns (-t) */
+#define HLOG_PATTERNS 64
+
+/* the merged histogram for a target (or all targets with -m) in a time window */
+struct group {
+    char *tag;
+    /* unix time the window starts, or 0 without -i */
+    time_t window;
+    struct hdr_histogram *histogram;
+    /* number of intervals merged */
+    unsigned long intervals;
+    struct group *next;
+};
+
+/* what each thread has read, for -v and errors */
+struct reader_stats {
+    pthread_t thread;
+    unsigned long files;
+    unsigned long intervals;
+    /* intervals that didn't match the filters */
+    unsigned long skipped;
+    /* values outside the range of the first histogram in a group */
+    long long dropped;
+    unsigned long errors;
+};
+
+/* global config "object" */
+static struct config {
+    /* -a only include intervals that start at or after this unix time, 0 = no limit */
+    double after;
+    /* -b only include intervals that start before this unix time, 0 = no limit */
+    double before;
+    /* -d only include intervals that start within this time of day, in minutes after midnight, -1 = all day */
+    int day_start;
+    int day_end;
+    /* -i merge intervals into windows of this many seconds, 0 = the whole time range */
+    unsigned long window;
+    /* -m merge all of the targets */
+    int merge;
+    /* -t only include targets that match one of these patterns */
+    char *patterns[HLOG_PATTERNS];
+    unsigned int pattern_count;
+    /* -p */
+    double percentiles[HLOG_PERCENTILES];
+    unsigned int percentile_count;
+} cfg;
+
+/* default config */
+const struct config CONFIG_DEFAULT = {
+    .after            = 0,
+    .before           = 0,
+    .day_start        = -1,
+    .day_end          = -1,
+    .window           = 0,
+    .merge            = 0,
+    .pattern_count    = 0,
+    .percentiles      = { 50, 90, 99, 99.9 },
+    .percentile_count = 4,
+};
+
+/* the log files, handed out to the threads in order */
+static char **files;
+static unsigned long file_count;
+static unsigned long next_file = 0;
+
+/* the merged histograms */
+static struct group *buckets[HLOG_BUCKETS];
+static pthread_mutex_t locks[HLOG_LOCKS];
+static unsigned long group_count = 0;
+
+/* local prototypes */
+static void usage(void);
+static double parse_time(const char *);
+static int parse_time_of_day(const char *);
+static int compare_percentiles(const void *, const void *);
+static unsigned int parse_percentiles(char *, double *);
+static unsigned long hash_group(const char *, time_t);
+static int match_target(const char *);
+static int match_time(double);
+static void merge_group(const char *, time_t, struct hdr_histogram *, struct reader_stats *);
+static void read_log(const char *, struct reader_stats *);
+static void *read_logs(void *);
+static int compare_groups(const void *, const void *);
+static void print_header(unsigned int);
+static void print_group(const struct group *, unsigned int);
+
+
+void usage() {
+    printf("Usage: nfshlog [options] [logs...]\n\
+Merge HdrHistogram interval logs (from nfsping -o) and print percentiles for each target\n\
+    -a time    only include intervals starting at or after time\n\
+    -b time    only include intervals starting before time\n\
+    -d hh:mm-hh:mm only include intervals starting between these times of day (local time)\n\
+    -h         display this help and exit\n\
+    -i n       merge intervals into n second windows (default the whole time range)\n\
+    -j n       decode logs in n threads (default one per CPU)\n\
+    -m         merge all of the targets together\n\
+    -p list    comma separated list of percentiles to print in order (default 50,90,99,99.9)\n\
+    -t pattern only include targets matching a shell pattern (can be repeated)\n\
+    -v         verbose output\n\
+Times are unix times, dates as YYYY-MM-DD[THH:MM[:SS]] in local time, or ages like 30d, 12h, 90m or 60s\n");
+
+    exit(3);
+}
+
+
+/* parse a time for -a and -b */
+/* returns the unix time or -1 on error */
+double parse_time(const char *input) {
+    /* formats for dates and times, tried in order */
+    const char *formats[] = {
+        "%Y-%m-%dT%H:%M:%S",
+        "%Y-%m-%d %H:%M:%S",
+        "%Y-%m-%dT%H:%M",
+        "%Y-%m-%d %H:%M",
+        "%Y-%m-%d",
+    };
+    struct tm tm;
+    struct timespec now;
+    char *end;
+    double value;
+    unsigned int i;
+
+    /* an age, ie 30d */
+    errno = 0;
+    value = strtod(input, &end);
+    if (errno == 0 && end != input && value >= 0) {
+        clock_gettime(CLOCK_REALTIME, &now);
+
+        switch (*end) {
+            /* a plain number is a unix time */
+            case '\0':
+                return value;
+            case 's':
+                break;
+            case 'm':
+                value *= 60;
+                break;
+            case 'h':
+                value *= 3600;
+                break;
+            case 'd':
+                value *= 86400;
+                break;
+            default:
+                /* try it as a date */
+                value = -1;
+        }
+
+        if (value >= 0 && end[1] == '\0') {
+            return now.tv_sec - value;
+        }
+    }
+
+    for (i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        memset(&tm, 0, sizeof(tm));
+        end = strptime(input, formats[i], &tm);
+        if (end && *end == '\0') {
+            /* let mktime() work out daylight saving time */
+            tm.tm_isdst = -1;
+            return mktime(&tm);
+        }
+    }
+
+    return -1;
+}
+
+
+/* parse a time of day as hh:mm for -d */
+/* returns minutes after midnight, or -1 on error */
+int parse_time_of_day(const char *input) {
+    unsigned int hours, minutes;
+    int length = 0;
+
+    if (sscanf(input, "%2u:%2u%n", &hours, &minutes, &length) != 2 || input[length] != '\0') {
+        return -1;
+    }
+
+    /* allow 24:00 for the end of the day */
+    if (minutes > 59 || hours * 60 + minutes > 24 * 60) {
+        return -1;
+    }
+
+    return hours * 60 + minutes;
+}
+
+
+/* qsort() comparison for percentiles */
+int compare_percentiles(const void *a, const void *b) {
+    const double first = *(const double *)a;
+    const double second = *(const double *)b;
+
+    return (first > second) - (first < second);
+}
+
+
+/* parse a comma separated list of percentiles for -p */
+/* they're sorted because hdr_value_at_percentiles() finds them all in one pass */
+/* returns the number of percentiles or 0 on error */
+unsigned int parse_percentiles(char *input, double *percentiles) {
+    char *token;
+    char *end;
+    unsigned int count = 0;
+
+    for (token = strtok(input, ","); token; token = strtok(NULL, ",")) {
+        if (count == HLOG_PERCENTILES) {
+            return 0;
+        }
+
+        errno = 0;
+        percentiles[count] = strtod(token, &end);
+        if (errno || end == token || *end != '\0' || percentiles[count] < 0 || percentiles[count] > 100) {
+            return 0;
+        }
+        count++;
+    }
+
+    qsort(percentiles, count, sizeof(double), compare_percentiles);
+
+    return count;
+}
+
+
+/* FNV-1a hash of a target name and window */
+unsigned long hash_group(const char *tag, time_t window) {
+    uint64_t hash = 14695981039346656037ULL;
+    unsigned int i;
+
+    for (; *tag; tag++) {
+        hash = (hash ^ (unsigned char)*tag) * 1099511628211ULL;
+    }
+
+    for (i = 0; i < sizeof(window); i++) {
+        hash = (hash ^ ((window >> (i * 8)) & 0xff)) * 1099511628211ULL;
+    }
+
+    return hash % HLOG_BUCKETS;
+}
+
+
+/* check a target name against the -t patterns */
+int match_target(const char *tag) {
+    unsigned int i;
+
+    if (cfg.pattern_count == 0) {
+        return 1;
+    }
+
+    for (i = 0; i < cfg.pattern_count; i++) {
+        if (fnmatch(cfg.patterns[i], tag, 0) == 0) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+/* check an interval's start time against -a, -b and -d */
+int match_time(double start) {
+    struct tm tm;
+    time_t seconds = start;
+    int minutes;
+
+    if (cfg.after && start < cfg.after) {
+        return 0;
+    }
+
+    if (cfg.before && start >= cfg.before) {
+        return 0;
+    }
+
+    if (cfg.day_start >= 0) {
+        localtime_r(&seconds, &tm);
+        minutes = tm.tm_hour * 60 + tm.tm_min;
+
+        /* the range can wrap around midnight, ie 23:00-01:00 */
+        if (cfg.day_start <= cfg.day_end) {
+            return minutes >= cfg.day_start && minutes < cfg.day_end;
+        } else {
+            return minutes >= cfg.day_start || minutes < cfg.day_end;
+        }
+    }
+
+    return 1;
+}
+
+
+/* add a decoded histogram to its group */
+/* the first histogram in a group becomes the group's histogram, the rest are freed after they're added */
+void merge_group(const char *tag, time_t window, struct hdr_histogram *histogram, struct reader_stats *stats) {
+    unsigned long bucket = hash_group(tag, window);
+    pthread_mutex_t *lock = &locks[bucket % HLOG_LOCKS];
+    struct group *group;
+
+    pthread_mutex_lock(lock);
+
+    for (group = buckets[bucket]; group; group = group->next) {
+        if (group->window == window && strcmp(group->tag, tag) == 0) {
+            break;
+        }
+    }
+
+    if (group) {
+        stats->dropped += hdr_add(group->histogram, histogram);
+        free(histogram);
+    } else {
+        group = calloc(1, sizeof(struct group));
+        if (group == NULL || (group->tag = strdup(tag)) == NULL) {
+            fatalx(3, "Couldn't allocate memory for histograms!\n");
+        }
+        group->window = window;
+        group->histogram = histogram;
+        group->next = buckets[bucket];
+        buckets[bucket] = group;
+        __atomic_add_fetch(&group_count, 1, __ATOMIC_RELAXED);
+    }
+
+    group->intervals++;
+
+    pthread_mutex_unlock(lock);
+}
+
+
+/* read a log file and merge its intervals */
+/* the lines are parsed here instead of with hdr_log_read() so the filters can skip decoding */
+void read_log(const char *path, struct reader_stats *stats) {
+    FILE *file;
+    struct hdr_log_reader reader;
+    struct hdr_histogram *histogram;
+    char *line = NULL;
+    size_t size = 0;
+    ssize_t len;
+    unsigned long line_number;
+    char *tag, *values, *base64, *end;
+    double start_time, start, log_start;
+    time_t window;
+    int status;
+
+    if (strcmp(path, "-") == 0) {
+        file = stdin;
+    } else {
+        file = fopen(path, "r");
+        if (file == NULL) {
+            fprintf(stderr, "%s: %s\n", path, strerror(errno));
+            stats->errors++;
+            return;
+        }
+    }
+
+    hdr_log_reader_init(&reader);
+    status = hdr_log_read_header(&reader, file);
+    if (status) {
+        fprintf(stderr, "%s: %s\n", path, hdr_strerror(status));
+        stats->errors++;
+        if (file != stdin) {
+            fclose(file);
+        }
+        return;
+    }
+
+    log_start = hdr_timespec_as_double(&reader.start_timestamp);
+    /* the number of header lines isn't known so line numbers are only counted from here */
+    line_number = 0;
+
+    while ((len = getline(&line, &size, file)) != -1) {
+        line_number++;
+
+        /* strip the newline */
+        while (len && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+            line[--len] = '\0';
+        }
+
+        /* logs that have been concatenated have more headers */
+        if (line[0] == '#') {
+            if (sscanf(line, "#[StartTime: %lf", &start_time) == 1) {
+                log_start = start_time;
+            }
+            continue;
+        }
+
+        if (line[0] == '"' || line[0] == '\0') {
+            continue;
+        }
+
+        /* Tag=name,start,interval,max,histogram */
+        tag = "";
+        values = line;
+        if (strncmp(line, "Tag=", 4) == 0) {
+            tag = line + 4;
+            values = strchr(tag, ',');
+            if (values == NULL) {
+                fprintf(stderr, "%s:%lu: invalid line\n", path, line_number);
+                stats->errors++;
+                continue;
+            }
+            *values++ = '\0';
+        }
+
+        start = strtod(values, &end);
+        /* skip the interval length and max */
+        if (*end != ',' || (end = strchr(end + 1, ',')) == NULL || (base64 = strchr(end + 1, ',')) == NULL) {
+            fprintf(stderr, "%s:%lu: invalid line\n", path, line_number);
+            stats->errors++;
+            continue;
+        }
+        base64++;
+
+        /* timestamps are usually offsets from the start time in the header */
+        if (start < log_start) {
+            start += log_start;
+        }
+
+        if (!match_target(tag) || !match_time(start)) {
+            stats->skipped++;
+            continue;
+        }
+
+        histogram = NULL;
+        status = hdr_log_decode(&histogram, base64, strlen(base64));
+        if (status) {
+            fprintf(stderr, "%s:%lu: %s\n", path, line_number, hdr_strerror(status));
+            stats->errors++;
+            continue;
+        }
+
+        window = cfg.window ? (time_t)start / cfg.window * cfg.window : 0;
+        merge_group(cfg.merge ? "" : tag, window, histogram, stats);
+        stats->intervals++;
+    }
+
+    if (ferror(file)) {
+        fprintf(stderr, "%s: %s\n", path, strerror(errno));
+        stats->errors++;
+    }
+
+    free(line);
+    if (file != stdin) {
+        fclose(file);
+    }
+
+    stats->files++;
+}
+
+
+/* thread to read log files until they've all been read */
+void *read_logs(void *arg) {
+    struct reader_stats *stats = arg;
+    unsigned long i;
+
+    while ((i = __atomic_fetch_add(&next_file, 1, __ATOMIC_RELAXED)) < file_count) {
+        read_log(files[i], stats);
+    }
+
+    return NULL;
+}
+
+
+/* qsort() comparison to sort groups by window and then target */
+int compare_groups(const void *a, const void *b) {
+    const struct group *first = *(struct group * const *)a;
+    const struct group *second = *(struct group * const *)b;
+
+    if (first->window != second->window) {
+        return first->window < second->window ? -1 : 1;
+    }
+
+    return strcmp(first->tag, second->tag);
+}
+
+
+void print_header(unsigned int maxhost) {
+    /* column spacing */
+    int spacing = 7;
+    char label[16];
+    unsigned int i;
+
+    if (cfg.window) {
+        printf("%-22s", "");
+    }
+
+    printf("{%-*s  %8s %*s", maxhost, "target", "count", spacing, "min");
+
+    for (i = 0; i < cfg.percentile_count; i++) {
+        snprintf(label, sizeof(label), "p%g", cfg.percentiles[i]);
+        printf(" %*s", spacing, label);
+    }
+
+    printf(" %*s\n", spacing, "max");
+}
+
+
+/* print a group's percentiles in milliseconds, the histograms are in microseconds */
+void print_group(const struct group *group, unsigned int maxhost) {
+    struct tm tm;
+    char window[20];
+    int64_t values[HLOG_PERCENTILES];
+    unsigned int i;
+
+    if (cfg.window) {
+        localtime_r(&group->window, &tm);
+        strftime(window, sizeof(window), "%Y-%m-%d %H:%M:%S", &tm);
+        printf("[%s] ", window);
+    }
+
+    printf("%-*s : %8" PRId64 " %7.3f",
+        maxhost, cfg.merge ? "all" : group->tag,
+        group->histogram->total_count,
+        hdr_min(group->histogram) / 1000.0);
+
+    hdr_value_at_percentiles(group->histogram, cfg.percentiles, values, cfg.percentile_count);
+    for (i = 0; i < cfg.percentile_count; i++) {
+        printf(" %7.3f", values[i] / 1000.0);
+    }
+
+    printf(" %7.3f ms\n", hdr_max(group->histogram) / 1000.0);
+}
+
+
+int main(int argc, char **argv) {
+    int ch;
+    char *dash;
+    long cpus;
+    unsigned long jobs = 0;
+    unsigned long i, j;
+    unsigned int maxhost = strlen("target");
+    struct reader_stats *stats;
+    struct reader_stats total = { 0 };
+    struct group **sorted;
+    struct group *group;
+    char *stdin_file[] = { "-" };
+
+    cfg = CONFIG_DEFAULT;
+
+    while ((ch = getopt(argc, argv, "a:b:d:hi:j:mp:t:v")) != -1) {
+        switch(ch) {
+            /* start time */
+            case 'a':
+                cfg.after = parse_time(optarg);
+                if (cfg.after < 0) {
+                    fatal("Invalid time for -a!\n");
+                }
+                break;
+            /* end time */
+            case 'b':
+                cfg.before = parse_time(optarg);
+                if (cfg.before < 0) {
+                    fatal("Invalid time for -b!\n");
+                }
+                break;
+            /* time of day */
+            case 'd':
+                dash = strchr(optarg, '-');
+                if (dash == NULL) {
+                    fatal("Invalid time range for -d!\n");
+                }
+                *dash = '\0';
+                cfg.day_start = parse_time_of_day(optarg);
+                cfg.day_end = parse_time_of_day(dash + 1);
+                if (cfg.day_start < 0 || cfg.day_end < 0 || cfg.day_start == cfg.day_end) {
+                    fatal("Invalid time range for -d!\n");
+                }
+                break;
+            /* window */
+            case 'i':
+                errno = 0;
+                cfg.window = strtoul(optarg, NULL, 10);
+                if (errno || cfg.window == 0) {
+                    fatal("Invalid window for -i!\n");
+                }
+                break;
+            /* threads */
+            case 'j':
+                errno = 0;
+                jobs = strtoul(optarg, NULL, 10);
+                if (errno || jobs == 0) {
+                    fatal("Invalid number of threads for -j!\n");
+                }
+                break;
+            case 'm':
+                cfg.merge = 1;
+                break;
+            case 'p':
+                cfg.percentile_count = parse_percentiles(optarg, cfg.percentiles);
+                if (cfg.percentile_count == 0) {
+                    fatal("Invalid percentiles for -p!\n");
+                }
+                break;
+            case 't':
+                if (cfg.pattern_count == HLOG_PATTERNS) {
+                    fatal("Too many patterns for -t!\n");
+                }
+                cfg.patterns[cfg.pattern_count++] = optarg;
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case 'h':
+            case '?':
+            default:
+                usage();
+        }
+    }
+
+    if (cfg.after && cfg.before && cfg.after >= cfg.before) {
+        fatal("-a has to be before -b!\n");
+    }
+
+    /* read stdin if there aren't any files */
+    if (optind == argc) {
+        files = stdin_file;
+        file_count = 1;
+    } else {
+        files = &argv[optind];
+        file_count = argc - optind;
+    }
+
+    /* decoding is the slow part so default to a thread per CPU */
+    if (jobs == 0) {
+        cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        jobs = cpus > 0 ? cpus : 1;
+    }
+
+    /* there's no point having more threads than files */
+    if (jobs > file_count) {
+        jobs = file_count;
+    }
+
+    for (i = 0; i < HLOG_LOCKS; i++) {
+        pthread_mutex_init(&locks[i], NULL);
+    }
+
+    stats = calloc(jobs, sizeof(struct reader_stats));
+    if (stats == NULL) {
+        fatalx(3, "Couldn't allocate memory for threads!\n");
+    }
+
+    debug("Reading %lu logs with %lu threads\n", file_count, jobs);
+
+    for (i = 0; i < jobs; i++) {
+        if (pthread_create(&stats[i].thread, NULL, read_logs, &stats[i])) {
+            fatalx(3, "Couldn't start thread!\n");
+        }
+    }
+
+    for (i = 0; i < jobs; i++) {
+        pthread_join(stats[i].thread, NULL);
+
+        total.files += stats[i].files;
+        total.intervals += stats[i].intervals;
+        total.skipped += stats[i].skipped;
+        total.dropped += stats[i].dropped;
+        total.errors += stats[i].errors;
+    }
+
+    debug("Read %lu intervals from %lu logs, skipped %lu\n", total.intervals, total.files, total.skipped);
+
+    if (total.dropped) {
+        fprintf(stderr, "%lld values were outside the range of the merged histograms and were dropped\n", total.dropped);
+    }
+
+    /* sort the groups for output */
+    sorted = calloc(group_count, sizeof(struct group *));
+    if (group_count && sorted == NULL) {
+        fatalx(3, "Couldn't allocate memory for histograms!\n");
+    }
+
+    j = 0;
+    for (i = 0; i < HLOG_BUCKETS; i++) {
+        for (group = buckets[i]; group; group = group->next) {
+            sorted[j++] = group;
+
+            if (strlen(group->tag) > maxhost) {
+                maxhost = strlen(group->tag);
+            }
+        }
+    }
+
+    qsort(sorted, group_count, sizeof(struct group *), compare_groups);
+
+    if (group_count) {
+        print_header(maxhost);
+    }
+
+    for (i = 0; i < group_count; i++) {
+        print_group(sorted[i], maxhost);
+    }
+
+    /* the histograms are freed on exit */
+    free(sorted);
+    free(stats);
+
+    return total.errors ? 1 : 0;
+}
@@ -5,6 +5,7 @@
 /* local prototypes */
 static void usage(void);
 static int do_nlm_test(CLIENT *, char *, pid_t, const char *, nfs_fh_list *);
+static void connect_target(targets_t *, struct addrinfo *, int, struct timeval, struct sockaddr_in, char *);
 
 /* globals */
 int verbose = 0;
@@ -100,6 +101,7 @@ int do_nlm_test(CLIENT *client, char *nodename, pid_t mypid, const char *host, n
         /* human output for now */
         /* use filehandle until we get the mount point from nfsmount, path can be ambiguous (or not present) */
         printf("%s:%s %lu %li\n", host, fh, us, wall_clock.tv_sec);
+        fflush(stdout);
         free(fh);
     } else {
         /* TODO still print a graphite result */
@@ -112,10 +114,36 @@ int do_nlm_test(CLIENT *client, char *nodename, pid_t mypid, const char *host, n
 }
 
 
+/* connect to a target's lock manager and find the client name to use in the lock requests */
+void connect_target(targets_t *target, struct addrinfo *hints, int version, struct timeval timeout, struct sockaddr_in src_ip, char *nodename) {
+    struct sockaddr_in clnt_info;
+    int getaddr;
+
+    target->client = create_rpc_client(target->client_sock, hints, NLM_PROG, version, timeout, src_ip);
+
+    if (target->client) {
+        auth_destroy(target->client->cl_auth);
+        target->client->cl_auth = authunix_create_default();
+
+        /* look up the address that was used to connect to the server */
+        /* TODO just use target->client_sock? */
+        clnt_control(target->client, CLGET_SERVER_ADDR, (char *)&clnt_info);
+
+        /* do a reverse lookup to find our client name */
+        /* we need this to populate the nlm test arguments */
+        /* TODO store this in the target_t struct? */
+        getaddr = getnameinfo((struct sockaddr *)&clnt_info, sizeof(struct sockaddr_in), nodename, NI_MAXHOST, NULL, 0, 0);
+        if (getaddr > 0) { /* failure! */
+            /* use something that doesn't overlap with values in nlm4_testres.stat */
+            fatalx(10, "%s: %s\n", target->name, gai_strerror(getaddr));
+        }
+    }
+}
+
+
 int main(int argc, char **argv) {
     int ch;
-    char *input_fh;
-    size_t n = 0; /* for getline() */
+    struct fh_reader input;
     targets_t dummy = { 0 };
     targets_t *targets = &dummy;
     targets_t *current = targets;
@@ -125,7 +153,6 @@ int main(int argc, char **argv) {
         /* default to UDP */
         .ai_socktype = SOCK_DGRAM,
     };
-    struct sockaddr_in clnt_info;
     int version = 4;
     unsigned long count = 1;
     int loop = 0;
@@ -141,7 +168,6 @@ int main(int argc, char **argv) {
     int status = 0;
     /* get the pid of the current process to use in the lock request(s) */
     pid_t mypid = getpid();
-    int getaddr;
     char nodename[NI_MAXHOST];
 
     while ((ch = getopt(argc, argv, "c:hH:lTv")) != -1) {
@@ -195,39 +221,43 @@ int main(int argc, char **argv) {
     }
 
     /* no arguments, use stdin */
-    while (getline(&input_fh, &n, stdin) != -1) {
-        /* don't allocate space for results */
-        current = parse_fh(targets, input_fh, 0, timeout, 0);
+    fh_reader_init(&input, stdin);
+    /* send the first round as each filehandle arrives instead of waiting for the end of the input */
+    /* don't allocate space for results */
+    while (read_fh(&input, targets, 0, 0, &current) != -1) {
+        /* couldn't parse the filehandle */
+        if (current == NULL) {
+            continue;
+        }
+
+        if (current->client == NULL) {
+            /* connect to server */
+            connect_target(current, &hints, version, timeout, src_ip, nodename);
+        }
+
+        /* the RPC */
+        if (current->client) {
+            status = do_nlm_test(current->client, nodename, mypid, current->name, current->last_filehandle);
+        }
     }
 
     targets = targets->next;
 
+    /* at this point we've sent one request to each target/filehandle */
+    sent++;
+
+    /* later rounds go through the whole list */
     while ((sent < count) || loop) {
+        /* sleep between requests */
+        nanosleep(&sleep_time, NULL);
+
         /* reset to start of list */
         current = targets;
 
         while (current) {
             if (current->client == NULL) {
                 /* connect to server */
-                current->client = create_rpc_client(current->client_sock, &hints, NLM_PROG, version, timeout, src_ip);
-
-                if (current->client) {
-                    auth_destroy(current->client->cl_auth);
-                    current->client->cl_auth = authunix_create_default();
-
-                    /* look up the address that was used to connect to the server */
-                    /* TODO just use current->client_sock? */
-                    clnt_control(current->client, CLGET_SERVER_ADDR, (char *)&clnt_info);
-
-                    /* do a reverse lookup to find our client name */
-                    /* we need this to populate the nlm test arguments */
-                    /* TODO store this in the target_t struct? */
-                    getaddr = getnameinfo((struct sockaddr *)&clnt_info, sizeof(struct sockaddr_in), nodename, NI_MAXHOST, NULL, 0, 0);
-                    if (getaddr > 0) { /* failure! */
-                        /* use something that doesn't overlap with values in nlm4_testres.stat */
-                        fatalx(10, "%s: %s\n", current->name, gai_strerror(getaddr));
-                    }
-                }
+                connect_target(current, &hints, version, timeout, src_ip, nodename);
             }
 
             filehandle = current->filehandles;
@@ -244,12 +274,7 @@ int main(int argc, char **argv) {
             current = current->next;
         } /* while (current) */
 
-        /* at this point we've sent one request to each target/filehandle */
         sent++;
-
-        /* sleep between requests */
-        /* TODO don't sleep on last round */
-        nanosleep(&sleep_time, NULL);
     }
 
     /* this is zero if everything worked, or the last error code seen */
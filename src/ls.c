@@ -56,6 +56,8 @@ static struct config {
     unsigned long version;
     struct timeval timeout;
     int quiet;
+    /* -B binary filehandle output */
+    int binary;
 } cfg;
 
 /* default config */
@@ -71,6 +73,7 @@ const struct config CONFIG_DEFAULT = {
     .version      = 3,
     .timeout      = NFS_TIMEOUT,
     .quiet        = 0,
+    .binary       = 0,
 };
 
 
@@ -83,6 +86,7 @@ List NFS files and directories from stdin\n\n\
     -a       print hidden files\n\
     -A       show IP addresses (default hostnames)\n\
     -b       display sizes in bytes\n\
+    -B       binary filehandle output for other nfsping tools\n\
     -c n     count of requests to send for each filehandle\n\
     -C n     same as -c, output parseable format\n\
     -d       list actual directory not contents\n\
@@ -678,12 +682,20 @@ int print_filehandles(targets_t *target, struct nfs_fh_list *fh, const unsigned
         /* if there is no filehandle (/dev, /proc, etc) don't print */
         /* none of the other utilities can do anything without a filehandle */
         if (current->name_handle.post_op_fh3_u.handle.data.data_len) {
-            print_entrypluslink3(current, target->name, target->ip_address, fh->path, usec);
+            if (cfg.binary) {
+                print_fh_record(target->name, target->client_sock->sin_addr, fh->path, current->name,
+                    current->name_handle.post_op_fh3_u.handle.data.data_val, current->name_handle.post_op_fh3_u.handle.data.data_len);
+            } else {
+                print_entrypluslink3(current, target->name, target->ip_address, fh->path, usec);
+            }
         }
 
         current = current->next;
     }
 
+    /* send the directory down the pipe straight away so the next program can start on it */
+    fflush(stdout);
+
     return count;
 }
 
@@ -804,8 +816,7 @@ void print_summary(targets_t *targets, enum ls_formats format) {
 
 int main(int argc, char **argv) {
     int ch; /* getopt */
-    char   *input_fh  = NULL;
-    size_t  input_len = 0;
+    struct fh_reader input;
     targets_t dummy = { 0 };
     targets_t *targets = &dummy;
     targets_t *current;
@@ -828,6 +839,8 @@ int main(int argc, char **argv) {
     };
     unsigned long hertz = NFS_HERTZ;
     unsigned long usec = 0;
+    /* number of results to allocate for each filehandle */
+    unsigned long results = 0;
     /* count of requests sent */
     unsigned long ls_sent = 0;
     /* count of successful requests */
@@ -835,7 +848,7 @@ int main(int argc, char **argv) {
 
     cfg = CONFIG_DEFAULT;
 
-    while ((ch = getopt(argc, argv, "aAbc:C:dghH:klLmMqS:tTv")) != -1) {
+    while ((ch = getopt(argc, argv, "aAbBc:C:dghH:klLmMqS:tTv")) != -1) {
         switch(ch) {
             /* list hidden files */
             case 'a':
@@ -853,6 +866,10 @@ int main(int argc, char **argv) {
                     fatal("Can't specify multiple units!\n");
                 }
                 break;
+            /* binary filehandle output */
+            case 'B':
+                cfg.binary = 1;
+                break;
             case 'c':
                 if (cfg.loop) {
                     fatal("Can't specify both -L and -c!\n");
@@ -985,6 +1002,10 @@ int main(int argc, char **argv) {
         cfg.format = ls_json;
     }
 
+    if (cfg.binary && cfg.format != ls_json) {
+        fatal("Binary output (-B) can't be combined with other output formats!\n");
+    }
+
     /* default to human output unless specified */
     /* TODO error or warning if size set but not -l? */
     if (cfg.prefix == NONE) {
@@ -1000,18 +1021,13 @@ int main(int argc, char **argv) {
     }
 
     /* no arguments, use stdin */
-    while (getline(&input_fh, &input_len, stdin) != -1) {
-        if (cfg.format == ls_fping || cfg.format == ls_longform) {
-            current = parse_fh(targets, input_fh, cfg.port, cfg.timeout, cfg.count);
-        } else {
-            /* don't allocate space for results */
-            current = parse_fh(targets, input_fh, cfg.port, cfg.timeout, 0);
-        }
+    /* the first round of requests is sent as the filehandles are read */
+    fh_reader_init(&input, stdin);
+    /* only allocate space for results if they're needed for the output */
+    if (cfg.format == ls_fping || cfg.format == ls_longform) {
+        results = cfg.count;
     }
 
-    /* skip the dummy entry */
-    targets = targets->next;
-
     /* set timezone for date output */
     /* TODO only with long_listing set? */
     tzset();
@@ -1021,7 +1037,8 @@ int main(int argc, char **argv) {
 
     /* main loop */
     while (1) {
-        current = targets;
+        /* start at the beginning of the list, or the next filehandle from the input */
+        filehandle = NULL;
 
 #ifdef CLOCK_MONOTONIC_RAW
         clock_gettime(CLOCK_MONOTONIC_RAW, &loop_start);
@@ -1030,7 +1047,7 @@ int main(int argc, char **argv) {
 #endif 
 
         /* send RPCs to each filehandle in each target */
-        while (current) {
+        while ((filehandle = next_fh(&input, targets, cfg.port, results, &current, filehandle))) {
             if (current->client == NULL) {
                 /* connect to server */
                 current->client = create_rpc_client(current->client_sock, &hints, NFS_PROGRAM, cfg.version, cfg.timeout, src_ip);
@@ -1039,76 +1056,68 @@ int main(int argc, char **argv) {
             }
 
             if (current->client) {
-                filehandle = current->filehandles;
-
-                while (filehandle) {
-                    /* count the time it takes to do all of the RPCs required for a full listing */
+                /* count the time it takes to do all of the RPCs required for a full listing */
 #ifdef CLOCK_MONOTONIC_RAW
-                    clock_gettime(CLOCK_MONOTONIC_RAW, &call_start);
+                clock_gettime(CLOCK_MONOTONIC_RAW, &call_start);
 #else
-                    clock_gettime(CLOCK_MONOTONIC, &call_start);
+                clock_gettime(CLOCK_MONOTONIC, &call_start);
 #endif
 
-                    /* if we're listing directories, do a getattr no matter what */
-                    /* check for a trailing slash to see if we need to do readdirplus or getattr */
-                    if (cfg.listdir || filehandle->path[strlen(filehandle->path) - 1] != '/') {
-                        filehandle->entries = do_getattr(current->client, current->name, filehandle);
-                    } else {
-                        /* store the directory entries in the filehandle list */
-                        filehandle->entries = do_readdirplus(current->client, current->name, filehandle);
-                    }
+                /* if we're listing directories, do a getattr no matter what */
+                /* check for a trailing slash to see if we need to do readdirplus or getattr */
+                if (cfg.listdir || filehandle->path[strlen(filehandle->path) - 1] != '/') {
+                    filehandle->entries = do_getattr(current->client, current->name, filehandle);
+                } else {
+                    /* store the directory entries in the filehandle list */
+                    filehandle->entries = do_readdirplus(current->client, current->name, filehandle);
+                }
 
 #ifdef CLOCK_MONOTONIC_RAW
-                    clock_gettime(CLOCK_MONOTONIC_RAW, &call_end);
+                clock_gettime(CLOCK_MONOTONIC_RAW, &call_end);
 #else
-                    clock_gettime(CLOCK_MONOTONIC, &call_end);
+                clock_gettime(CLOCK_MONOTONIC, &call_end);
 #endif
 
-                    ls_sent++;
-                    filehandle->sent++;
-                    current->sent++;
+                ls_sent++;
+                filehandle->sent++;
+                current->sent++;
 
-                    /* check if we got a result */
-                    if (filehandle->entries) {
-                        ls_ok++;
-                        filehandle->received++;
-                        current->received++;
-                    }
-
-                    /* calculate elapsed microseconds */
-                    timespecsub(&call_end, &call_start, &call_elapsed);
-                    usec = ts2us(call_elapsed);
-
-                    if (usec < filehandle->min) filehandle->min = usec;
-                    if (usec > filehandle->max) filehandle->max = usec;
-                    /* recalculate the average time */
-                    filehandle->avg = (filehandle->avg * (filehandle->received - 1) + usec) / filehandle->received;
-
-                    /*
-                    TODO make an outputs enum with json/longform/ping/fping/graphite/statsd
-                    print_output function to switch
-                    iterate through entries and call print_nfs_fh3 if json
-                    some option to print raw request results in JSON including cookie (-d?)
-                    */
-
-                    if (cfg.format == ls_json) {
-                        print_filehandles(current, filehandle, usec);
-                    } else if (!cfg.quiet && (cfg.format == ls_ping || cfg.format == ls_fping)) {
-                        print_ping(current, filehandle, usec);
-                    }
+                /* check if we got a result */
+                if (filehandle->entries) {
+                    ls_ok++;
+                    filehandle->received++;
+                    current->received++;
+                }
 
-                    /* store the response time for fping summary or long listing output */
-                    if (cfg.format == ls_fping || cfg.format == ls_longform) {
-                        /* record result for each filehandle */
-                        filehandle->results[filehandle->sent - 1] = usec;
-                    }
+                /* calculate elapsed microseconds */
+                timespecsub(&call_end, &call_start, &call_elapsed);
+                usec = ts2us(call_elapsed);
+
+                if (usec < filehandle->min) filehandle->min = usec;
+                if (usec > filehandle->max) filehandle->max = usec;
+                /* recalculate the average time */
+                filehandle->avg = (filehandle->avg * (filehandle->received - 1) + usec) / filehandle->received;
+
+                /*
+                TODO make an outputs enum with json/longform/ping/fping/graphite/statsd
+                print_output function to switch
+                iterate through entries and call print_nfs_fh3 if json
+                some option to print raw request results in JSON including cookie (-d?)
+                */
+
+                if (cfg.format == ls_json) {
+                    print_filehandles(current, filehandle, usec);
+                } else if (!cfg.quiet && (cfg.format == ls_ping || cfg.format == ls_fping)) {
+                    print_ping(current, filehandle, usec);
+                }
 
-                    filehandle = filehandle->next;
-                } /* while (filehandle) */
+                /* store the response time for fping summary or long listing output */
+                if (cfg.format == ls_fping || cfg.format == ls_longform) {
+                    /* record result for each filehandle */
+                    filehandle->results[filehandle->sent - 1] = usec;
+                }
             }
-
-            current = current->next;
-        } /* while (current) */
+        } /* while (filehandle) */
 
 #ifdef CLOCK_MONOTONIC_RAW
         clock_gettime(CLOCK_MONOTONIC_RAW, &loop_end);
@@ -1119,7 +1128,7 @@ int main(int argc, char **argv) {
         /* pass the whole list for printing long listing */
         /* do this once so output can be justified to longest user/group name */
         if (cfg.format == ls_longform) {
-            print_long_listing(targets);
+            print_long_listing(targets->next);
         }
 
         if (quitting) {
@@ -1127,8 +1136,8 @@ int main(int argc, char **argv) {
         }
 
         /* only sleep if looping or counting */
-        /* check the count against the first filehandle in the first target */
-        if (cfg.loop || (cfg.count && targets->filehandles->sent < cfg.count)) {
+        /* check the count against the first filehandle in the first target, skipping the dummy entry */
+        if (cfg.loop || (cfg.count && targets->next && targets->next->filehandles->sent < cfg.count)) {
             /* measure how long the current round took, and subtract that from the sleep time */
             /* this keeps us on the polling frequency */
             timespecsub(&loop_end, &loop_start, &loop_elapsed);
@@ -1150,7 +1159,7 @@ int main(int argc, char **argv) {
 
     /* if looping or counting, print a summary */
     if (cfg.loop || cfg.count) {
-        print_summary(targets, cfg.format);
+        print_summary(targets->next, cfg.format);
     }
 
     /* return success if all requests came back ok */
@@ -20,7 +20,7 @@ static void unmount_client(CLIENT *, char *);
 static int print_exports(char *, struct exportnode *);
 static struct mount_exports *make_exports(targets_t *);
 static int print_fhandle3(JSON_Value *, const fhandle3, const unsigned long, const struct timespec);
-void print_output(enum outputs, const char *, const int, const char *, const char *, struct mount_exports *, const fhandle3, const struct timespec, unsigned long);
+void print_output(enum outputs, const char *, const int, const targets_t *, const char *, const char *, struct mount_exports *, const fhandle3, const struct timespec, unsigned long);
 void print_summary(targets_t *, enum outputs, const int, const int);
 
 /* globals */
@@ -43,6 +43,8 @@ static struct config {
     int unmount;
     struct timeval timeout;
     unsigned long hertz;
+    /* -B binary filehandle output */
+    int binary;
 } cfg;
 
 /* default config */
@@ -64,6 +66,7 @@ const struct config CONFIG_DEFAULT = {
     .quiet     = 0,
     .reconnect = 1,
     .unmount   = 1,
+    .binary    = 0,
 };
 
 
@@ -116,6 +119,7 @@ void usage() {
      */
     printf("Usage: nfsmount [options] host[:mountpoint]\n\
     -A       show IP addresses\n\
+    -B       binary filehandle output for other nfsping tools (implies -J)\n\
     -c n     count of mount requests to send to target\n\
     -C n     same as -c, output parseable format\n\
     -D       print timestamp (unix time) before each line\n\
@@ -493,7 +497,7 @@ int print_fhandle3(JSON_Value *json_root, const fhandle3 file_handle, const unsi
 
 
 /* print output to stdout in different formats for each mount result */
-void print_output(enum outputs format, const char *prefix, const int width, const char *display_name, const char *ndqf, struct mount_exports *export, const fhandle3 file_handle, const struct timespec wall_clock, unsigned long usec) {
+void print_output(enum outputs format, const char *prefix, const int width, const targets_t *target, const char *display_name, const char *ndqf, struct mount_exports *export, const fhandle3 file_handle, const struct timespec wall_clock, unsigned long usec) {
     double loss = (export->sent - export->received) / export->sent * 100.0;
     char epoch[TIME_T_MAX_DIGITS]; /* the largest time_t seconds value, plus a terminating NUL */
     struct tm *secs;
@@ -540,7 +544,11 @@ void print_output(enum outputs format, const char *prefix, const int width, cons
             break;
         /* print the filehandle as JSON */
         case json:
-            print_fhandle3(export->json_root, file_handle, usec, wall_clock);
+            if (cfg.binary) {
+                print_fh_record(target->name, target->client_sock->sin_addr, export->path, NULL, file_handle.fhandle3_val, file_handle.fhandle3_len);
+            } else {
+                print_fhandle3(export->json_root, file_handle, usec, wall_clock);
+            }
             break;
         /* this is handled in print_exports() */
         case showmount:
@@ -551,6 +559,9 @@ void print_output(enum outputs format, const char *prefix, const int width, cons
             fatal("Need a format!\n");
             break;
     }
+
+    /* send each result down the pipe straight away so the next program can start on it */
+    fflush(stdout);
 }
 
 
@@ -683,7 +694,7 @@ int main(int argc, char **argv) {
     if (argc == 1)
         usage();
 
-    while ((ch = getopt(argc, argv, "Ac:C:dDeEGhH:JlmqRS:TuvV:")) != -1) {
+    while ((ch = getopt(argc, argv, "ABc:C:dDeEGhH:JlmqRS:TuvV:")) != -1) {
         switch(ch) {
             /* show IP addresses instead of hostnames */
             case 'A':
@@ -891,6 +902,10 @@ int main(int argc, char **argv) {
                 /* TODO check for reasonable values */
                 cfg.hertz = strtoul(optarg, NULL, 10);
                 break;
+            /* binary output is JSON output in a different encoding so it has the same conflicts */
+            case 'B':
+                cfg.binary = 1;
+                /* fall through */
             case 'J':
                 /* check for conflicting format options */
                 switch (cfg.format) {
@@ -1017,7 +1032,7 @@ int main(int argc, char **argv) {
         }
 
         /* make possibly multiple new targets */
-        make_target(targets, host, &hints, cfg.port, cfg.dns, cfg.ip, cfg.multiple, cfg.timeout, path, cfg.count);
+        make_target(targets, host, &hints, cfg.port, cfg.dns, cfg.ip, cfg.multiple, path, cfg.count);
 
         optind++;
     }
@@ -1149,7 +1164,7 @@ int main(int argc, char **argv) {
                                 display_name = current->name;
                             }
 
-                            print_output(cfg.format, cfg.prefix, width, display_name, current->ndqf, export, root, wall_clock, usec);
+                            print_output(cfg.format, cfg.prefix, width, current, display_name, current->ndqf, export, root, wall_clock, usec);
                         }
                     }
 
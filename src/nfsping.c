@@ -1,7 +1,13 @@
 #include "nfsping.h"
 #include "util.h"
 #include "rpc.h"
+#include "async.h"
+#include "hdr/src/hdr_interval_recorder.h"
+#include "hdr/src/hdr_histogram_log.h"
 #include <sys/ioctl.h> /* for checking terminal size */
+#include <sys/resource.h> /* for getrusage() */
+#include <sys/mman.h> /* for mmap() */
+#include <pthread.h>
 
 /* Globals! */
 extern volatile sig_atomic_t quitting;
@@ -16,13 +22,90 @@ enum ping_outputs {
     ping_statsd,
 };
 
+/* the percentiles in the ping output, looked up together with hdr_value_at_percentiles() */
+/* median not mean! */
+static const double ping_percentiles[] = { 50.0, 90.0, 99.0 };
+#define PING_PERCENTILES (sizeof(ping_percentiles) / sizeof(ping_percentiles[0]))
+
+/* how often the reporter thread checks on the workers (-j) */
+#define WORKER_TICK { 0, 100000000 } /* 100ms */
+
+/* settings shared by all of the worker threads (-j) */
+struct worker_options {
+    enum ping_outputs format;
+    char *prefix;
+    int quiet;
+    unsigned long prognum_offset;
+    u_long version;
+    /* number of rounds, or 0 to loop forever */
+    unsigned long count;
+    struct timespec sleep_time;
+};
+
+/* results a worker has recorded since the reporter last looked */
+/* each worker has two of these which the reporter swaps with hdr_interval_recorder_sample() */
+struct worker_sample {
+    /* completed requests (including lost ones) for each target in the worker's shard */
+    unsigned int *sent;
+    /* response times, the total count is the number of responses */
+    struct hdr_histogram **histograms;
+    /* kernel timestamped response times (-k), or NULL */
+    struct hdr_histogram **wire_histograms;
+};
+
+/* a worker thread (-j) running its own asynchronous engine on a shard of the targets */
+struct worker {
+    pthread_t thread;
+    const struct worker_options *options;
+    struct async_engine *engine;
+    struct hdr_interval_recorder recorder;
+    struct worker_sample samples[2];
+    /* the most requests sent to any target in the shard, for the fping summary */
+    unsigned long rounds;
+    /* set by the worker when it's done */
+    int finished;
+};
+
+/* what the requests have cost so far, for -v */
+struct cost {
+    struct async_stats stats;
+    /* user and system CPU time for the whole process */
+    unsigned long cpu_us;
+};
+
+/* a completed request, passed to worker_record() */
+struct worker_update {
+    unsigned long index;
+    int received;
+    unsigned long us;
+    int wire;
+    unsigned long wire_us;
+};
+
 /* local prototypes */
 static void usage(void);
 static void print_interval(enum ping_outputs, char *, targets_t *, unsigned long, u_long, const struct timespec);
 static void print_summary(enum ping_outputs, unsigned long, targets_t *);
 static void print_result(enum ping_outputs, unsigned int, char *, targets_t *, unsigned long, u_long, const struct timespec, unsigned long);
 static void print_lost(enum ping_outputs, char *, targets_t *, unsigned long, u_long, const struct timespec);
+static void print_wire(enum ping_outputs, char *, targets_t *, unsigned long, u_long, const struct timespec, unsigned long);
 static void print_header(enum ping_outputs, unsigned int, unsigned long, u_long);
+static void record_result(enum ping_outputs, targets_t *, unsigned long, unsigned long, unsigned long);
+static void spill_results(targets_t *, unsigned long, unsigned long);
+static void store_result(targets_t *, unsigned long, unsigned long);
+static void reset_interval(enum ping_outputs, targets_t *);
+static void log_interval(targets_t *, const struct timespec);
+static void print_async_error(targets_t *, unsigned long, u_long, const struct async_result *);
+static void worker_init(struct worker *, const struct worker_options *, targets_t *, unsigned long, unsigned long, struct timeval, struct sockaddr_in, int, unsigned int);
+static void worker_record(void *, void *);
+static void *worker_loop(void *);
+static void merge_sample(enum ping_outputs, struct worker *, unsigned long *, unsigned long *);
+static unsigned long engine_rounds(const struct async_engine *);
+static double parse_hertz(const char *);
+static void print_jitter(struct hdr_histogram *);
+static void print_cost(const char *, const struct async_stats *, struct cost *);
+static long max_rss(void);
+static void print_memory(const targets_t *, unsigned long, long);
 
 /* global config "object" */
 static struct config {
@@ -32,6 +115,30 @@ static struct config {
     int display_ips;
     /* -Q quiet summary interval (seconds) */
     unsigned int summary_interval;
+    /* -b busy-wait before sending */
+    struct timespec spin;
+    /* -B send requests that are nearly due together */
+    struct timespec batch;
+    /* -J print send jitter */
+    int jitter;
+    /* -k kernel timestamps */
+    int timestamps;
+    /* -I io_uring */
+    int uring;
+    /* -F significant figures for the response time histograms */
+    int figures;
+    /* -o interval histogram log */
+    char *log_path;
+    FILE *log;
+    struct hdr_log_writer log_writer;
+    /* wall clock time in the log header, the intervals are offsets from this */
+    struct timespec log_start;
+    /* fping results (-C) are stored in a temporary file mapped into memory */
+    /* each target has its own range of the file, page aligned so it can be dropped from memory separately */
+    char *spill;
+    size_t spill_size;
+    size_t spill_stride;
+    size_t page_size;
 } cfg;
 
 /* default config */
@@ -39,6 +146,15 @@ const struct config CONFIG_DEFAULT = {
     .reverse_dns      = 0,
     .display_ips      = 0,
     .summary_interval = 0,
+    .spin             = { 0, 0 },
+    .batch            = { 0, 0 },
+    .jitter           = 0,
+    .timestamps       = 0,
+    .uring            = 0,
+    .figures          = 3,
+    .log_path         = NULL,
+    .log              = NULL,
+    .spill            = NULL,
 };
 
 /* dispatch table for null function calls, this saves us from a bunch of if statements */
@@ -88,16 +204,24 @@ void usage() {
     printf("Usage: nfsping [options] [targets...]\n\
     -a         check the NFS ACL protocol (default NFS)\n\
     -A         show IP addresses (default hostnames)\n\
+    -b n       busy-wait for the last n microseconds before sending (default 0)\n\
+    -B n       send requests due within n microseconds of each other together (implies -e)\n\
     -c n       count of pings to send to target\n\
     -C n       same as -c, output parseable format\n\
     -d         reverse DNS lookups for targets\n\
     -D         print timestamp (unix time) before each line\n\
+    -e         send requests to all targets at once (asynchronous, UDP only)\n\
     -E         StatsD format output (default human readable)\n\
+    -F n       significant figures for the response time histograms (1-5, default 3)\n\
     -g string  prefix for Graphite/StatsD metric names (default \"nfsping\")\n\
     -G         Graphite format output (default human readable)\n\
     -h         display this help and exit\n\
     -H n       frequency in Hertz (pings per second, default %i)\n\
     -i n       interval between sending packets (in ms, default %lu)\n\
+    -I         send and receive with io_uring (implies -U 1 unless -U is given)\n\
+    -j n       send from n worker threads (implies -e)\n\
+    -J         print how late requests were sent compared to the schedule\n\
+    -k         also time responses with kernel timestamps (implies -e)\n\
     -K         check the kernel lock manager (KLM) protocol (default NFS)\n\
     -l         loop forever (default)\n\
     -L         check the network lock manager (NLM) protocol (default NFS)\n\
@@ -105,6 +229,7 @@ void usage() {
     -M         use the portmapper (default: NFS/ACL no, mount/NLM/NSM/rquota yes)\n\
     -n         check the mount protocol (default NFS)\n\
     -N         check the portmap protocol (default NFS)\n\
+    -o file    write each interval's histograms to an HdrHistogram log (needs -Q)\n\
     -P n       specify port (default: NFS %i, portmap %i)\n\
     -q         quiet, only print summary\n\
     -Q n       same as -q, but show summary every n seconds\n\
@@ -114,6 +239,7 @@ void usage() {
     -t n       timeout (in ms, default %lu)\n\
     -T         use TCP (default UDP)\n\
     -u         check the rquota protocol (default NFS)\n\
+    -U n       send from n shared UDP sockets (implies -e)\n\
     -v         verbose output\n\
     -V n       specify NFS version (2/3/4, default 3)\n",
     NFS_HERTZ, ts2ms(wait_time), NFS_PORT, PMAPPORT, tv2ms(timeout));
@@ -130,6 +256,10 @@ void print_interval(enum ping_outputs format, char *prefix, targets_t *target, u
     unsigned int lost = target->sent - target->received;
     /* TODO check for division by zero */
     double loss = lost / (double)target->sent * 100;
+    int64_t values[PING_PERCENTILES];
+    /* the 95th percentile for graphite */
+    const double upper = 95.0;
+    double mean;
 
     switch (format) {
         case ping_unset:
@@ -167,14 +297,14 @@ void print_interval(enum ping_outputs format, char *prefix, targets_t *target, u
         case ping_ping:
             /* only print times if we got any responses */
             if (target->received) {
+                hdr_value_at_percentiles(target->interval_histogram, ping_percentiles, values, PING_PERCENTILES);
                 printf("%s : %3u %7.3f %7.3f %7.3f %7.3f %7.3f ms\n",
                     target->display_name,
                     target->received,
                     hdr_min(target->interval_histogram) / 1000.0,
-                    /* median not mean! */
-                    hdr_value_at_percentile(target->interval_histogram, 50.0) / 1000.0,
-                    hdr_value_at_percentile(target->interval_histogram, 90.0) / 1000.0,
-                    hdr_value_at_percentile(target->interval_histogram, 99.0) / 1000.0,
+                    values[0] / 1000.0,
+                    values[1] / 1000.0,
+                    values[2] / 1000.0,
                     hdr_max(target->interval_histogram) / 1000.0);
             }
             break;
@@ -197,6 +327,9 @@ void print_interval(enum ping_outputs format, char *prefix, targets_t *target, u
 
             /* the histogram will be empty if there weren't any results */
             if (target->received) {
+                /* the mean and 95th percentile in one pass */
+                hdr_value_at_percentiles_and_mean(target->interval_histogram, &upper, values, 1, &mean);
+
                 /* max */
                 printf("%s.%s.%s.usec.upper %.2f %li\n",
                     prefix, target->ndqf, null_dispatch[prognum_offset][version].protocol,
@@ -215,7 +348,7 @@ void print_interval(enum ping_outputs format, char *prefix, targets_t *target, u
                 /* mean */
                 printf("%s.%s.%s.usec.mean %.2f %li\n",
                     prefix, target->ndqf, null_dispatch[prognum_offset][version].protocol,
-                    hdr_mean(target->interval_histogram) / 1000.0,
+                    mean / 1000.0,
                     now.tv_sec);
 
                 /* sum_95th */
@@ -224,7 +357,7 @@ void print_interval(enum ping_outputs format, char *prefix, targets_t *target, u
                 /* 95th */
                 printf("%s.%s.%s.usec.upper_95th %.2f %li\n",
                     prefix, target->ndqf, null_dispatch[prognum_offset][version].protocol,
-                    hdr_value_at_percentile(target->interval_histogram, 95.0) / 1000.0,
+                    values[0] / 1000.0,
                     now.tv_sec);
 
                 /* mean_95th */
@@ -252,15 +385,20 @@ void print_interval(enum ping_outputs format, char *prefix, targets_t *target, u
 
 /* print a final summary before exiting */
 /* fping format prints to stderr for compatibility */
-void print_summary(enum ping_outputs format, unsigned long total_sent, targets_t *targets) {
+void print_summary(enum ping_outputs format, unsigned long rounds, targets_t *targets) {
     targets_t *current = targets;
     unsigned long i;
 
+    /* read the results back from the start of the file */
+    if (cfg.spill) {
+        madvise(cfg.spill, cfg.spill_size, MADV_SEQUENTIAL);
+    }
+
     while (current) {
         /* print a parseable summary string in fping-compatible format */
         if (format == ping_fping) {
             fprintf(stderr, "%s :", current->display_name);
-            for (i = 0; i < total_sent; i++) {
+            for (i = 0; i < rounds; i++) {
                 if (current->results[i]) {
                     fprintf(stderr, " %.2f", current->results[i] / 1000.0);
                 } else {
@@ -268,6 +406,9 @@ void print_summary(enum ping_outputs format, unsigned long total_sent, targets_t
                 }
             }
             fprintf(stderr, "\n");
+
+            /* finished with this target's results */
+            madvise(current->results, cfg.spill_stride, MADV_DONTNEED);
         } else if (format == ping_ping) {
             /* blank line to separate from results */
             /* TODO only if !quiet */
@@ -275,6 +416,12 @@ void print_summary(enum ping_outputs format, unsigned long total_sent, targets_t
 
             printf("%s :\n", current->display_name);
             hdr_percentiles_print(current->histogram, stdout, 5, 1000.0, CLASSIC);
+
+            /* the same responses timed by the kernel, the difference is our own overhead */
+            if (current->wire_histogram) {
+                printf("\n%s (wire) :\n", current->display_name);
+                hdr_percentiles_print(current->wire_histogram, stdout, 5, 1000.0, CLASSIC);
+            }
         }
 
         current = current->next;
@@ -284,9 +431,10 @@ void print_summary(enum ping_outputs format, unsigned long total_sent, targets_t
 
 /* print formatted output after each ping */
 void print_result(enum ping_outputs format, unsigned int maxhost, char *prefix, targets_t *target, unsigned long prognum_offset, u_long version, const struct timespec now, unsigned long us) {
-    double loss = (target->sent - target->received) / (double)target->sent * 100;
+    double loss;
     char epoch[TIME_T_MAX_DIGITS]; /* the largest time_t seconds value, plus a terminating NUL */
     struct tm *secs;
+    int64_t values[PING_PERCENTILES];
 
     switch (format) {
         case ping_unset:
@@ -301,21 +449,24 @@ void print_result(enum ping_outputs format, unsigned int maxhost, char *prefix,
             /* fall through to fping output, this just prepends the current time */
             /*FALLTHROUGH*/
         case ping_fping:
+            /* only here, the -j workers print graphite and statsd results while the reporter thread updates the counts */
+            loss = (target->sent - target->received) / (double)target->sent * 100;
             printf("%s : [%u], %03.2f ms (%03.2f avg, %.0f%% loss)\n",
                 target->display_name, target->sent - 1, us / 1000.0, target->avg / 1000.0, loss);
             break;
+        /* there aren't any intervals when printing each result so this is the same as the interval histogram would be */
         case ping_ping:
+            hdr_value_at_percentiles(target->histogram, ping_percentiles, values, PING_PERCENTILES);
             /* TODO print the hostname and (ip address) */
             printf("%-*s : %7.3f %7.3f %7.3f %7.3f %7.3f %7.3f ms\n",
                 maxhost,
                 target->display_name,
                 us / 1000.0,
-                hdr_min(target->interval_histogram) / 1000.0,
-                /* median not mean! */
-                hdr_value_at_percentile(target->interval_histogram, 50.0) / 1000.0,
-                hdr_value_at_percentile(target->interval_histogram, 90.0) / 1000.0,
-                hdr_value_at_percentile(target->interval_histogram, 99.0) / 1000.0,
-                hdr_max(target->interval_histogram) / 1000.0);
+                hdr_min(target->histogram) / 1000.0,
+                values[0] / 1000.0,
+                values[1] / 1000.0,
+                values[2] / 1000.0,
+                hdr_max(target->histogram) / 1000.0);
             break;
         case ping_graphite:
             printf("%s.%s.%s.usec %lu %li\n",
@@ -350,6 +501,433 @@ void print_lost(enum ping_outputs format, char *prefix, targets_t *target, unsig
 }
 
 
+/* print the kernel timestamped response time after each ping (-k) */
+/* only for the formats that send each result somewhere, the others get it in the summary */
+void print_wire(enum ping_outputs format, char *prefix, targets_t *target, unsigned long prognum_offset, u_long version, const struct timespec now, unsigned long us) {
+    if (format == ping_graphite) {
+        printf("%s.%s.%s.wire.usec %lu %li\n",
+            prefix, target->ndqf, null_dispatch[prognum_offset][version].protocol, us, now.tv_sec);
+    } else if (format == ping_statsd) {
+        printf("%s.%s.%s.wire:%03.2f|ms\n",
+            prefix, target->ndqf, null_dispatch[prognum_offset][version].protocol, us / 1000.0);
+    }
+    fflush(stdout);
+}
+
+
+/* store the result of a successful request */
+/* index is the round number, for storing fping results */
+/* expected is the time between requests to the target in microseconds, or 0 if requests aren't delayed by slow responses */
+void record_result(enum ping_outputs format, targets_t *target, unsigned long index, unsigned long us, unsigned long expected) {
+    if (format == ping_fping) {
+        if (us < target->min) target->min = us;
+        if (us > target->max) target->max = us;
+        /* calculate the average time */
+        target->avg = (target->avg * (target->received - 1) + us) / target->received;
+
+        /* store the result for the final output */
+        store_result(target, index, us);
+    } else {
+        /* if we're waiting for each response before sending the next request, a slow response means we missed sending */
+        /* the requests that should have gone out in the meantime (coordinated omission) */
+        /* so fill in the results those requests would have seen */
+        hdr_record_corrected_value(target->histogram, us, expected);
+        /* only allocated with -Q */
+        if (target->interval_histogram) {
+            hdr_record_corrected_value(target->interval_histogram, us, expected);
+        }
+    }
+}
+
+
+/* map a temporary file to store each target's fping results (-C) */
+/* the results are only written once and read once at the end so they don't need to stay in memory */
+/* the file goes in $TMPDIR, which should be on disk rather than tmpfs for long runs */
+void spill_results(targets_t *targets, unsigned long target_count, unsigned long count) {
+    const char *tmpdir = getenv("TMPDIR");
+    char path[PATH_MAX];
+    targets_t *target;
+    unsigned long i = 0;
+    int fd;
+
+    if (tmpdir == NULL || tmpdir[0] == '\0') {
+        tmpdir = "/tmp";
+    }
+
+    cfg.page_size = sysconf(_SC_PAGESIZE);
+    /* round each target's results up to whole pages */
+    cfg.spill_stride = (count * sizeof(uint32_t) + cfg.page_size - 1) / cfg.page_size * cfg.page_size;
+    cfg.spill_size = cfg.spill_stride * target_count;
+
+    snprintf(path, sizeof(path), "%s/nfsping.XXXXXX", tmpdir);
+    fd = mkstemp(path);
+    if (fd < 0) {
+        fatalx(3, "Couldn't create results file in %s: %s\n", tmpdir, strerror(errno));
+    }
+
+    /* nobody else needs the file, it'll be removed when we exit */
+    unlink(path);
+
+    /* the file is sparse, any results that aren't written read back as 0 which is a lost response */
+    if (ftruncate(fd, cfg.spill_size)) {
+        fatalx(3, "Couldn't allocate results file: %s\n", strerror(errno));
+    }
+
+    cfg.spill = mmap(NULL, cfg.spill_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (cfg.spill == MAP_FAILED) {
+        fatalx(3, "Couldn't map results file: %s\n", strerror(errno));
+    }
+
+    /* the mapping keeps its own reference to the file */
+    close(fd);
+
+    for (target = targets; target; target = target->next) {
+        target->results = (uint32_t *)(cfg.spill + i * cfg.spill_stride);
+        i++;
+    }
+}
+
+
+/* store an fping result in the target's range of the results file */
+/* index is the round number */
+void store_result(targets_t *target, unsigned long index, unsigned long us) {
+    const unsigned long per_page = cfg.page_size / sizeof(uint32_t);
+
+    target->results[index] = us;
+
+    /* once a target starts a new page of results the earlier ones won't be needed until the summary */
+    /* so let the kernel write them out and drop them, the occasional late response just reads its page back in */
+    if (index % per_page == 0 && index) {
+        madvise(target->results, index * sizeof(uint32_t), MADV_DONTNEED);
+    }
+}
+
+
+/* reset a target's counters after printing an interval summary */
+void reset_interval(enum ping_outputs format, targets_t *target) {
+    target->sent = 0;
+    target->received = 0;
+    if (format == ping_fping) {
+        target->min = ULONG_MAX;
+        target->max = 0;
+        target->avg = 0;
+    } else {
+        hdr_reset(target->interval_histogram);
+    }
+}
+
+
+/* write a target's interval histogram to the log (-o) before it's reset */
+/* each line is tagged with the target's name so the log can hold all of them */
+void log_interval(targets_t *target, const struct timespec now) {
+    struct hdr_log_entry log_entry = {
+        .tag = target->display_name,
+        .tag_len = strlen(target->display_name),
+    };
+    int status;
+
+    /* the start is an offset from the log's start time, followed by the interval's length */
+    timespecsub(&target->interval_start, &cfg.log_start, &log_entry.start_timestamp);
+    timespecsub(&now, &target->interval_start, &log_entry.interval);
+    target->interval_start = now;
+
+    status = hdr_log_write_entry(&cfg.log_writer, cfg.log, &log_entry, target->interval_histogram);
+    if (status || fflush(cfg.log)) {
+        fatalx(3, "Couldn't write to %s: %s\n", cfg.log_path, status ? hdr_strerror(status) : strerror(errno));
+    }
+}
+
+
+/* print the reason an asynchronous request failed */
+void print_async_error(targets_t *target, unsigned long prognum_offset, u_long version, const struct async_result *result) {
+    fprintf(stderr, "%s : %s: %s", target->display_name, null_dispatch[prognum_offset][version].name, clnt_sperrno(result->status));
+    if (result->error) {
+        fprintf(stderr, "; errno = %s", strerror(result->error));
+    }
+    fprintf(stderr, "\n");
+    fflush(stderr);
+}
+
+
+/* set up a worker thread for count targets starting at targets */
+void worker_init(struct worker *worker, const struct worker_options *options, targets_t *targets, unsigned long count, unsigned long prognum, struct timeval timeout, struct sockaddr_in src_ip, int reconnect, unsigned int sockets) {
+    struct worker_sample *sample;
+    unsigned long i;
+    int j;
+
+    worker->options = options;
+    worker->engine = async_init(targets, count, prognum, null_dispatch[options->prognum_offset][options->version].version, timeout, src_ip, reconnect, sockets);
+    if (cfg.timestamps && async_timestamps(worker->engine)) {
+        fatalx(3, "Couldn't enable kernel timestamps!\n");
+    }
+    if (cfg.uring && async_uring(worker->engine)) {
+        fatalx(3, "Couldn't set up io_uring!\n");
+    }
+
+    for (j = 0; j < 2; j++) {
+        sample = &worker->samples[j];
+        sample->sent = calloc(count, sizeof(unsigned int));
+        sample->histograms = calloc(count, sizeof(struct hdr_histogram *));
+        if (sample->sent == NULL || sample->histograms == NULL) {
+            fatalx(3, "Couldn't allocate memory for worker!\n");
+        }
+
+        for (i = 0; i < count; i++) {
+            /* same range as the targets' histograms so hdr_add() doesn't drop anything */
+            if (hdr_init(1, tv2us(timeout), cfg.figures, &sample->histograms[i])) {
+                fatalx(3, "Couldn't allocate memory for histograms!\n");
+            }
+        }
+
+        if (cfg.timestamps) {
+            sample->wire_histograms = calloc(count, sizeof(struct hdr_histogram *));
+            if (sample->wire_histograms == NULL) {
+                fatalx(3, "Couldn't allocate memory for worker!\n");
+            }
+
+            for (i = 0; i < count; i++) {
+                if (hdr_init(1, tv2us(timeout), cfg.figures, &sample->wire_histograms[i])) {
+                    fatalx(3, "Couldn't allocate memory for histograms!\n");
+                }
+            }
+        }
+    }
+
+    if (hdr_interval_recorder_init(&worker->recorder)) {
+        fatalx(3, "Couldn't initialise interval recorder!\n");
+    }
+    worker->recorder.active = &worker->samples[0];
+    worker->recorder.inactive = &worker->samples[1];
+}
+
+
+/* hdr_interval_recorder_update() action to record a completed request in the active sample */
+/* this runs in the worker thread */
+void worker_record(void *active, void *arg) {
+    struct worker_sample *sample = active;
+    struct worker_update *update = arg;
+
+    /* count requests when they complete instead of when they're sent */
+    /* so an interval never has more responses than requests */
+    sample->sent[update->index]++;
+
+    if (update->received) {
+        hdr_record_value(sample->histograms[update->index], update->us);
+    }
+
+    if (update->wire) {
+        hdr_record_value(sample->wire_histograms[update->index], update->wire_us);
+    }
+}
+
+
+/* the worker thread main loop */
+/* sends requests to each target in the shard on a schedule like the -e loop in main() */
+/* the targets' statistics belong to the reporter so everything is recorded through the interval recorder */
+void *worker_loop(void *arg) {
+    struct worker *worker = arg;
+    const struct worker_options *options = worker->options;
+    struct async_engine *engine = worker->engine;
+    struct async_result results[ASYNC_EVENTS];
+    struct worker_update update;
+    targets_t *target;
+    int done, i;
+
+    async_start(engine, options->sleep_time, options->count, cfg.spin, cfg.batch);
+
+    while (!quitting && !async_finished(engine)) {
+        done = async_run(engine, results, ASYNC_EVENTS);
+
+        for (i = 0; i < done; i++) {
+            target = results[i].target;
+
+            update.index = results[i].index;
+            update.received = (results[i].status == RPC_SUCCESS);
+            update.us = results[i].us;
+            update.wire = update.received && results[i].wire;
+            update.wire_us = results[i].wire_us;
+            hdr_interval_recorder_update(&worker->recorder, worker_record, &update);
+
+            /* other threads are printing too so keep each target's output together */
+            flockfile(stdout);
+            if (update.received) {
+                /* each target only belongs to one worker so this doesn't need any locking */
+                if (options->format == ping_fping) {
+                    store_result(target, results[i].seq, update.us);
+                }
+
+                /* only formats that don't need the target's statistics get this far without -q */
+                if (!options->quiet) {
+                    print_result(options->format, 0, options->prefix, target, options->prognum_offset, options->version, results[i].wall_clock, update.us);
+
+                    if (update.wire) {
+                        print_wire(options->format, options->prefix, target, options->prognum_offset, options->version, results[i].wall_clock, update.wire_us);
+                    }
+                }
+            } else {
+                print_lost(options->format, options->prefix, target, options->prognum_offset, options->version, results[i].wall_clock);
+                print_async_error(target, options->prognum_offset, options->version, &results[i]);
+            }
+            funlockfile(stdout);
+        }
+    }
+
+    worker->rounds = engine_rounds(engine);
+
+    __atomic_store_n(&worker->finished, 1, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+
+/* add the results a worker has recorded since last time to its targets */
+/* this runs in the reporter (main) thread which owns the targets' statistics */
+void merge_sample(enum ping_outputs format, struct worker *worker, unsigned long *total_sent, unsigned long *total_recv) {
+    /* swap the samples, the worker won't touch the old one again until the next swap */
+    struct worker_sample *sample = hdr_interval_recorder_sample(&worker->recorder);
+    struct hdr_histogram *histogram;
+    targets_t *target;
+    unsigned long i, received;
+
+    for (i = 0; i < worker->engine->count; i++) {
+        target = worker->engine->targets[i].target;
+        histogram = sample->histograms[i];
+        received = histogram->total_count;
+
+        target->sent += sample->sent[i];
+        *total_sent += sample->sent[i];
+        sample->sent[i] = 0;
+
+        if (received) {
+            if (format == ping_fping) {
+                if ((unsigned long)hdr_min(histogram) < target->min) target->min = hdr_min(histogram);
+                if ((unsigned long)hdr_max(histogram) > target->max) target->max = hdr_max(histogram);
+                target->avg = (target->avg * target->received + hdr_mean(histogram) * received) / (target->received + received);
+            } else {
+                hdr_add(target->histogram, histogram);
+                if (target->interval_histogram) {
+                    hdr_add(target->interval_histogram, histogram);
+                }
+            }
+
+            target->received += received;
+            *total_recv += received;
+            hdr_reset(histogram);
+        }
+
+        if (sample->wire_histograms && sample->wire_histograms[i]->total_count) {
+            hdr_add(target->wire_histogram, sample->wire_histograms[i]);
+            hdr_reset(sample->wire_histograms[i]);
+        }
+    }
+}
+
+
+/* parse a frequency in Hertz, which can be fractional */
+/* returns 0 if it's invalid */
+double parse_hertz(const char *arg) {
+    char *end;
+    double hertz;
+
+    errno = 0;
+    hertz = strtod(arg, &end);
+
+    if (errno || end == arg || *end != '\0' || !isfinite(hertz) || hertz <= 0) {
+        return 0;
+    }
+
+    return hertz;
+}
+
+
+/* print how late requests were sent compared to the schedule (-J) */
+/* print to stderr to keep it separate from the results */
+void print_jitter(struct hdr_histogram *jitter) {
+    fflush(stdout);
+    fprintf(stderr, "\nsend jitter (us) :\n");
+    hdr_percentiles_print(jitter, stderr, 5, 1000.0, CLASSIC);
+}
+
+
+/* print how many system calls and how much CPU time the requests used since last time (-v) */
+/* the synchronous loop doesn't count system calls so only prints the CPU time */
+/* last is updated to the current counts */
+void print_cost(const char *label, const struct async_stats *stats, struct cost *last) {
+    struct rusage usage;
+    unsigned long requests = stats->requests - last->stats.requests;
+    unsigned long syscalls = stats->syscalls - last->stats.syscalls;
+    unsigned long cpu_us;
+
+    getrusage(RUSAGE_SELF, &usage);
+    cpu_us = tv2us(usage.ru_utime) + tv2us(usage.ru_stime);
+
+    if (syscalls) {
+        debug("%s: %lu syscalls for %lu requests and %lu responses (%.2f per request), %lu sockets opened\n",
+            label, syscalls, requests, stats->responses - last->stats.responses,
+            requests ? syscalls / (double)requests : 0.0, stats->sockets - last->stats.sockets);
+    }
+
+    debug("%s: %.3fs CPU for %lu requests (%.1fus per request)\n",
+        label, (cpu_us - last->cpu_us) / 1000000.0, requests,
+        requests ? (cpu_us - last->cpu_us) / (double)requests : 0.0);
+
+    last->stats = *stats;
+    last->cpu_us = cpu_us;
+}
+
+
+/* the most memory the process has used so far, in kilobytes */
+long max_rss() {
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss;
+}
+
+
+/* print how much memory each target needs, for -v */
+/* baseline is the RSS before the targets were set up */
+void print_memory(const targets_t *targets, unsigned long count, long baseline) {
+    const targets_t *target;
+    size_t histograms = 0;
+    long rss = max_rss();
+
+    if (count == 0) {
+        return;
+    }
+
+    for (target = targets; target; target = target->next) {
+        if (target->histogram) {
+            histograms += hdr_get_memory_size(target->histogram);
+        }
+        if (target->interval_histogram) {
+            histograms += hdr_get_memory_size(target->interval_histogram);
+        }
+        if (target->wire_histogram) {
+            histograms += hdr_get_memory_size(target->wire_histogram);
+        }
+    }
+
+    debug("memory: %ld kB max RSS, %.0f bytes per target (%lu bytes of histograms)\n",
+        rss, (rss - baseline) * 1024.0 / count, histograms / count);
+}
+
+
+/* the most requests the engine has sent to any target, for the fping summary */
+unsigned long engine_rounds(const struct async_engine *engine) {
+    unsigned long i, rounds = 0;
+
+    for (i = 0; i < engine->count; i++) {
+        if (engine->targets[i].sent > rounds) {
+            rounds = engine->targets[i].sent;
+        }
+    }
+
+    return rounds;
+}
+
+
 /* prints a header line */
 void print_header(enum ping_outputs format, unsigned int maxhost, unsigned long prognum_offset, u_long version) {
     /* column spacing */
@@ -387,7 +965,14 @@ int main(int argc, char **argv) {
     struct timespec wall_clock, call_start, call_end, call_elapsed, loop_start, loop_end, loop_elapsed, sleep_time;
     struct timespec sleepy = { 0 };
     /* polling frequency */
-    unsigned long hertz = NFS_HERTZ;
+    double hertz = NFS_HERTZ;
+    /* per-target polling frequency from the target list */
+    double target_hertz;
+    char *at;
+    targets_t *last;
+    int target_rates = 0;
+    /* number of rounds between interval summaries */
+    unsigned long interval_rounds = 0;
     struct timespec wait_time = NFS_WAIT;
     uint16_t port = NFS_PORT;
     unsigned long prognum = NFS_PROGRAM;
@@ -399,6 +984,30 @@ int main(int argc, char **argv) {
     };
     struct rpc_err clnt_err;
     unsigned long us;
+    /* asynchronous requests */
+    int async = 0;
+    /* number of shared sockets, 0 = one per target */
+    unsigned int sockets = 0;
+    struct async_engine *engine = NULL;
+    struct async_result results[ASYNC_EVENTS];
+    unsigned long target_index;
+    int done, i;
+    /* worker threads */
+    unsigned long jobs = 0;
+    struct worker *workers = NULL;
+    struct worker_options worker_options;
+    unsigned long target_count = 0, shard_size, finished;
+    sigset_t sigint, sigmask;
+    struct timespec worker_tick = WORKER_TICK;
+    struct timespec now, next_report, report_wait;
+    /* pacing */
+    struct timespec next_round, late;
+    /* system call counts for -v */
+    struct async_stats stats = { 0 };
+    struct cost last_cost = { 0 };
+    /* memory in use before any targets are set up, for -v */
+    long baseline_rss;
+    struct hdr_histogram *jitter;
     /* default to unset so we can check in getopt */
     enum ping_outputs format = ping_unset;
     char prefix[255] = "nfsping";
@@ -441,7 +1050,7 @@ int main(int argc, char **argv) {
         usage();
 
 
-    while ((ch = getopt(argc, argv, "aAc:C:dDEg:GhH:i:KlLmMnNP:qQ:RsS:t:TuvV:")) != -1) {
+    while ((ch = getopt(argc, argv, "aAb:B:c:C:dDeEF:g:GhH:i:Ij:JkKlLmMnNo:P:qQ:RsS:t:TuU:vV:")) != -1) {
         switch(ch) {
             /* NFS ACL protocol */
             case 'a':
@@ -464,6 +1073,16 @@ int main(int argc, char **argv) {
                     cfg.display_ips = 1;
                 }
                 break;
+            /* busy-wait */
+            case 'b':
+                us2ts(&cfg.spin, strtoul(optarg, NULL, 10));
+                break;
+            /* batch requests */
+            case 'B':
+                us2ts(&cfg.batch, strtoul(optarg, NULL, 10));
+                /* only the asynchronous engine has a schedule for each target */
+                async = 1;
+                break;
             /* number of pings per target, parseable summary */
             case 'C':
                 if (loop) {
@@ -554,6 +1173,10 @@ int main(int argc, char **argv) {
                         break;
                 }
                 break;
+            /* asynchronous requests */
+            case 'e':
+                async = 1;
+                break;
             /* [E]tsy's StatsD output */
             case 'E':
                 switch (format) {
@@ -573,6 +1196,13 @@ int main(int argc, char **argv) {
                         break;
                 }
                 break;
+            /* histogram precision */
+            case 'F':
+                cfg.figures = strtoul(optarg, NULL, 10);
+                if (cfg.figures < 1 || cfg.figures > 5) {
+                    fatal("Invalid number of significant figures for -F!\n");
+                }
+                break;
             /* prefix to use for graphite metrics */
             case 'g':
                 strncpy(prefix, optarg, sizeof(prefix));
@@ -598,10 +1228,9 @@ int main(int argc, char **argv) {
                 break;
             /* polling frequency */
             case 'H':
-                errno = 0;
-                hertz = strtoul(optarg, NULL, 10);
+                hertz = parse_hertz(optarg);
                 /* check for errors or zero */
-                if (errno + hertz == 0) {
+                if (hertz == 0) {
                     fatal("Invalid frequency for -H!\n");
                 }
                 break;
@@ -609,6 +1238,31 @@ int main(int argc, char **argv) {
             case 'i':
                 ms2ts(&wait_time, strtoul(optarg, NULL, 10));
                 break;
+            /* io_uring */
+            case 'I':
+                cfg.uring = 1;
+                async = 1;
+                break;
+            /* worker threads */
+            case 'j':
+                errno = 0;
+                jobs = strtoul(optarg, NULL, 10);
+                if (errno + jobs == 0) {
+                    fatal("Invalid number of threads for -j!\n");
+                }
+                /* each thread runs an asynchronous engine */
+                async = 1;
+                break;
+            /* print send jitter */
+            case 'J':
+                cfg.jitter = 1;
+                break;
+            /* kernel timestamps */
+            case 'k':
+                cfg.timestamps = 1;
+                /* only the asynchronous engine reads the timestamps */
+                async = 1;
+                break;
             case 'K':
                 if (prognum == NFS_PROGRAM) {
                     prognum = KLM_PROG;
@@ -688,6 +1342,10 @@ int main(int argc, char **argv) {
                     fatal("Only one protocol!\n");
                 }
                 break;
+            /* interval histogram log */
+            case 'o':
+                cfg.log_path = optarg;
+                break;
             /* specify port */
             case 'P':
                 /* check if we've set -M */
@@ -749,6 +1407,16 @@ int main(int argc, char **argv) {
                     fatal("Only one protocol!\n");
                 }
                 break;
+            /* shared sockets */
+            case 'U':
+                errno = 0;
+                sockets = strtoul(optarg, NULL, 10);
+                if (errno + sockets == 0) {
+                    fatal("Invalid number of sockets for -U!\n");
+                }
+                /* only works with asynchronous requests */
+                async = 1;
+                break;
             /* verbose */
             case 'v':
                 verbose = 1;
@@ -778,21 +1446,58 @@ int main(int argc, char **argv) {
         loop = 1;
     }
 
+    /* the log is written with each interval summary */
+    if (cfg.log_path) {
+        if (cfg.summary_interval == 0) {
+            fatal("-o needs -Q!\n");
+        }
+
+        /* fping output doesn't keep histograms */
+        if (format == ping_fping) {
+            fatal("Can't specify both -o and -C!\n");
+        }
+    }
+
+    /* io_uring is only used with shared sockets */
+    if (cfg.uring) {
+        if (cfg.timestamps) {
+            fatal("Can't specify both -I and -k!\n");
+        }
+
+        if (sockets == 0) {
+            sockets = 1;
+        }
+    }
+
+    /* the asynchronous engine only does UDP */
+    /* TODO TCP */
+    if (async && hints.ai_socktype == SOCK_STREAM) {
+        fatal("Can't specify both -%c and -T!\n", jobs ? 'j' : cfg.uring ? 'I' : sockets ? 'U' : cfg.timestamps ? 'k' : timespecisset(&cfg.batch) ? 'B' : 'e');
+    }
+
+    /* the per-result output for these formats uses each target's running statistics */
+    /* which are only updated by the reporter thread */
+    if (jobs && !quiet && (format == ping_ping || format == ping_unixtime || format == ping_fping)) {
+        fatal("-j needs -q or -Q unless using -E or -G!\n");
+    }
+
+    /* the number of rounds in each interval summary, at least one for frequencies below 1Hz */
+    if (cfg.summary_interval) {
+        interval_rounds = hertz * cfg.summary_interval + 0.5;
+        if (interval_rounds == 0) {
+            interval_rounds = 1;
+        }
+    }
+
     /* check that we'll have something to output */
-    if (count && (hertz * cfg.summary_interval) >= count) {
+    if (count && interval_rounds >= count) {
         fatal("Interval (-Q) too small for count!\n");
     }
 
     /* calculate the sleep_time based on the frequency */
-    /* check for a frequency of 1, that's a simple case */
-    /* this doesn't support frequencies lower than 1Hz */
-    if (hertz == 1) {
-        sleep_time.tv_sec = 1;
-        sleep_time.tv_nsec = 0;
-    } else {
-        sleep_time.tv_sec = 0;
-        /* nanoseconds */
-        sleep_time.tv_nsec = 1000000000 / hertz;
+    hz2ts(&sleep_time, hertz);
+    if (sleep_time.tv_sec == 0 && sleep_time.tv_nsec == 0) {
+        fatal("Invalid frequency for -H!\n");
     }
 
     /* calculate this once */
@@ -832,27 +1537,56 @@ int main(int argc, char **argv) {
         usage();
     }
 
+    baseline_rss = max_rss();
+
     /* process the targets from the command line */
+    last = targets;
     for (index = optind; index < argc; index++) {
-        if (format == ping_fping) {
-            /* allocate space for all results */
-            make_target(targets, argv[index], &hints, port, cfg.reverse_dns, cfg.display_ips, multiple, timeout, NULL, count);
-        } else {
-            /* don't allocate space for storing results */
-            make_target(targets, argv[index], &hints, port, cfg.reverse_dns, cfg.display_ips, multiple, timeout, NULL, 0);
+        /* targets can have their own frequency, ie filer@50 or archive@0.2 */
+        target_hertz = 0;
+        at = strrchr(argv[index], '@');
+        if (at) {
+            *at = '\0';
+            target_hertz = parse_hertz(at + 1);
+            if (target_hertz == 0) {
+                fatal("Invalid frequency for %s!\n", argv[index]);
+            }
+            target_rates = 1;
+        }
+
+        /* don't allocate space for storing results, fping results go in a file once all of the targets are known */
+        make_target(targets, argv[index], &hints, port, cfg.reverse_dns, cfg.display_ips, multiple, NULL, 0);
+
+        /* set the frequency on any new targets, duplicates keep the first one */
+        while (last->next) {
+            last = last->next;
+            if (target_hertz) {
+                hz2ts(&last->period, target_hertz);
+                if (last->period.tv_sec == 0 && last->period.tv_nsec == 0) {
+                    fatal("Invalid frequency for %s!\n", argv[index]);
+                }
+            }
         }
     }
 
+    /* the synchronous loop sends to every target in turn each round */
+    if (target_rates && !async) {
+        fatal("Per-target frequencies need -e!\n");
+    }
+
     /* skip the first dummy entry */
     targets = targets->next;
     target = targets;
 
     while (target) {
+        target_count++;
+
         /* find the longest name for output spacing */
         maxhost = (strlen(target->display_name) > maxhost) ? strlen(target->display_name) : maxhost;
 
         /* check that the total waiting time between targets isn't going to cause us to miss our frequency (Hertz) */
-        if (wait_time.tv_sec || wait_time.tv_nsec) {
+        /* asynchronous requests are all sent at once so there's no waiting */
+        if (!async && (wait_time.tv_sec || wait_time.tv_nsec)) {
             /* add up the wait interval for each target */
             timespecadd(&wait_time, &sleepy, &sleepy);
 
@@ -861,17 +1595,281 @@ int main(int argc, char **argv) {
             }
         }
 
+        /* fping output keeps each result instead */
+        /* interval histograms are only needed for -Q */
+        if (format != ping_fping) {
+            if (hdr_init(1, tv2us(timeout), cfg.figures, &target->histogram)) {
+                fatalx(3, "Couldn't allocate memory for histograms!\n");
+            }
+
+            if (cfg.summary_interval && hdr_init(1, tv2us(timeout), cfg.figures, &target->interval_histogram)) {
+                fatalx(3, "Couldn't allocate memory for histograms!\n");
+            }
+        }
+
+        /* same range as the other histogram */
+        if (cfg.timestamps && hdr_init(1, tv2us(timeout), cfg.figures, &target->wire_histogram)) {
+            fatalx(3, "Couldn't allocate memory for histograms!\n");
+        }
+
         target = target->next;
     }
 
     /* reset to start of target list */
     target = targets;
 
+    if (format == ping_fping) {
+        spill_results(targets, target_count, count);
+    }
+
+    if (hdr_init(1, ASYNC_MAX_JITTER, 3, &jitter)) {
+        fatalx(3, "Couldn't allocate memory for histogram!\n");
+    }
+
+    /* start the log, the first interval for each target starts now */
+    if (cfg.log_path) {
+        cfg.log = fopen(cfg.log_path, "w");
+        if (cfg.log == NULL) {
+            fatal("Couldn't open %s: %s\n", cfg.log_path, strerror(errno));
+        }
+
+        clock_gettime(CLOCK_REALTIME, &cfg.log_start);
+        if (hdr_log_writer_init(&cfg.log_writer) || hdr_log_write_header(&cfg.log_writer, cfg.log, "nfsping response times in microseconds", &cfg.log_start)) {
+            fatal("Couldn't write to %s!\n", cfg.log_path);
+        }
+
+        for (target = targets; target; target = target->next) {
+            target->interval_start = cfg.log_start;
+        }
+        target = targets;
+    }
+
     /* print a header at the start */
     if (!quiet || cfg.summary_interval) {
         print_header(format, maxhost, prognum_offset, version);
     }
 
+    if (jobs) {
+        worker_options = (struct worker_options) {
+            .format         = format,
+            .prefix         = prefix,
+            .quiet          = quiet,
+            .prognum_offset = prognum_offset,
+            .version        = version,
+            .count          = count,
+            .sleep_time     = sleep_time,
+        };
+
+        /* no point in having idle threads */
+        if (jobs > target_count) {
+            jobs = target_count;
+        }
+
+        workers = calloc(jobs, sizeof(struct worker));
+        if (workers == NULL) {
+            fatalx(3, "Couldn't allocate memory for workers!\n");
+        }
+
+        /* split the target list into contiguous shards, spreading any remainder over the first few */
+        for (target_index = 0; target_index < jobs; target_index++) {
+            shard_size = target_count / jobs + (target_index < target_count % jobs);
+            worker_init(&workers[target_index], &worker_options, target, shard_size, prognum, timeout, src_ip, reconnect, sockets);
+
+            while (shard_size--) {
+                target = target->next;
+            }
+        }
+
+        /* leave ctrl-c to the main thread, the workers check quitting at least once per timeout */
+        sigemptyset(&sigint);
+        sigaddset(&sigint, SIGINT);
+        pthread_sigmask(SIG_BLOCK, &sigint, &sigmask);
+
+        for (target_index = 0; target_index < jobs; target_index++) {
+            if (pthread_create(&workers[target_index].thread, NULL, worker_loop, &workers[target_index])) {
+                fatalx(3, "Couldn't create worker thread!\n");
+            }
+        }
+
+        pthread_sigmask(SIG_SETMASK, &sigmask, NULL);
+
+        /* the main thread is now the reporter */
+        clock_gettime(CLOCK_MONOTONIC, &next_report);
+        next_report.tv_sec += cfg.summary_interval;
+
+        do {
+            /* wake up for the next interval or to check if the workers are done */
+            report_wait = worker_tick;
+            if (cfg.summary_interval) {
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                if (timespeccmp(&next_report, &now, >)) {
+                    timespecsub(&next_report, &now, &report_wait);
+                    if (timespeccmp(&report_wait, &worker_tick, >)) {
+                        report_wait = worker_tick;
+                    }
+                } else {
+                    timespecclear(&report_wait);
+                }
+            }
+            nanosleep(&report_wait, NULL);
+
+            /* this is a wall clock interval instead of counting rounds since each worker keeps its own rounds */
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            if (cfg.summary_interval && !quitting && timespeccmp(&now, &next_report, >=)) {
+                next_report.tv_sec += cfg.summary_interval;
+
+                for (target_index = 0; target_index < jobs; target_index++) {
+                    merge_sample(format, &workers[target_index], &total_sent, &total_recv);
+                }
+
+                clock_gettime(CLOCK_REALTIME, &wall_clock);
+                flockfile(stdout);
+                for (target = targets; target; target = target->next) {
+                    print_interval(format, prefix, target, prognum_offset, version, wall_clock);
+                    if (cfg.log) {
+                        log_interval(target, wall_clock);
+                    }
+                    reset_interval(format, target);
+                }
+                fflush(stdout);
+                funlockfile(stdout);
+            }
+
+            finished = 0;
+            for (target_index = 0; target_index < jobs; target_index++) {
+                finished += __atomic_load_n(&workers[target_index].finished, __ATOMIC_ACQUIRE);
+            }
+        } while (finished < jobs && !quitting);
+
+        for (target_index = 0; target_index < jobs; target_index++) {
+            pthread_join(workers[target_index].thread, NULL);
+
+            /* pick up anything recorded since the last interval */
+            merge_sample(format, &workers[target_index], &total_sent, &total_recv);
+
+            /* print the fping summary for as many requests as the busiest worker sent */
+            if (workers[target_index].rounds > loop_count) {
+                loop_count = workers[target_index].rounds;
+            }
+
+            hdr_add(jitter, workers[target_index].engine->jitter);
+
+            stats.requests  += workers[target_index].engine->stats.requests;
+            stats.responses += workers[target_index].engine->stats.responses;
+            stats.syscalls  += workers[target_index].engine->stats.syscalls;
+            stats.sockets   += workers[target_index].engine->stats.sockets;
+
+            async_destroy(workers[target_index].engine);
+        }
+
+        print_cost("total", &stats, &last_cost);
+
+        /* skip the main loop */
+        target = NULL;
+    } else if (async) {
+        engine = async_init(targets, target_count, prognum, null_dispatch[prognum_offset][version].version, timeout, src_ip, reconnect, sockets);
+        if (cfg.timestamps && async_timestamps(engine)) {
+            fatalx(3, "Couldn't enable kernel timestamps!\n");
+        }
+        if (cfg.uring && async_uring(engine)) {
+            fatalx(3, "Couldn't set up io_uring!\n");
+        }
+
+        /* find the number of rows in the terminal for printing the header once per screen */
+        ioctl(STDOUT_FILENO, TIOCGWINSZ, &winsz);
+        rows = winsz.ws_row;
+
+        clock_gettime(CLOCK_MONOTONIC, &next_report);
+        next_report.tv_sec += cfg.summary_interval;
+
+        /* send to each target on a fixed schedule instead of in rounds */
+        async_start(engine, sleep_time, count, cfg.spin, cfg.batch);
+
+        /* a round is one polling interval (-H) for reporting system calls */
+        clock_gettime(CLOCK_MONOTONIC, &next_round);
+        timespecadd(&next_round, &sleep_time, &next_round);
+
+        while (!quitting && !async_finished(engine)) {
+            done = async_run(engine, results, ASYNC_EVENTS);
+
+            for (i = 0; i < done; i++) {
+                target = results[i].target;
+
+                /* count requests when they complete so an interval never has more responses than requests */
+                target->sent++;
+                total_sent++;
+
+                /* print a header for every screen of output */
+                if (!quiet && rows && (total_sent % rows == 0)) {
+                    print_header(format, maxhost, prognum_offset, version);
+                }
+
+                if (results[i].status == RPC_SUCCESS) {
+                    target->received++;
+                    total_recv++;
+
+                    /* requests go out on schedule no matter how long the responses take so there's nothing to correct */
+                    record_result(format, target, results[i].seq, results[i].us, 0);
+
+                    if (results[i].wire) {
+                        hdr_record_value(target->wire_histogram, results[i].wire_us);
+                    }
+
+                    if (!quiet) {
+                        print_result(format, maxhost, prefix, target, prognum_offset, version, results[i].wall_clock, results[i].us);
+
+                        if (results[i].wire) {
+                            print_wire(format, prefix, target, prognum_offset, version, results[i].wall_clock, results[i].wire_us);
+                        }
+                    }
+                } else {
+                    print_lost(format, prefix, target, prognum_offset, version, results[i].wall_clock);
+                    print_async_error(target, prognum_offset, version, &results[i]);
+                }
+            }
+
+            /* check if we should print a periodic summary */
+            /* there aren't any rounds so this uses the clock */
+            if (cfg.summary_interval) {
+                clock_gettime(CLOCK_MONOTONIC, &now);
+
+                if (timespeccmp(&now, &next_report, >=)) {
+                    next_report.tv_sec += cfg.summary_interval;
+                    clock_gettime(CLOCK_REALTIME, &wall_clock);
+
+                    for (target = targets; target; target = target->next) {
+                        print_interval(format, prefix, target, prognum_offset, version, wall_clock);
+                        if (cfg.log) {
+                            log_interval(target, wall_clock);
+                        }
+                        reset_interval(format, target);
+                    }
+                }
+            }
+
+            if (verbose) {
+                clock_gettime(CLOCK_MONOTONIC, &now);
+
+                if (timespeccmp(&now, &next_round, >=)) {
+                    timespecadd(&next_round, &sleep_time, &next_round);
+                    print_cost("round", &engine->stats, &last_cost);
+                }
+            }
+        }
+
+        loop_count = engine_rounds(engine);
+
+        print_cost("round", &engine->stats, &last_cost);
+        last_cost = (struct cost) { 0 };
+        print_cost("total", &engine->stats, &last_cost);
+
+        /* skip the main loop */
+        target = NULL;
+    }
+
+    /* the rounds are scheduled from here */
+    clock_gettime(CLOCK_MONOTONIC, &next_round);
+
     /* the main loop */
     while(target) {
         loop_count++;
@@ -947,19 +1945,8 @@ int main(int argc, char **argv) {
                 timespecsub(&call_end, &call_start, &call_elapsed);
                 us = ts2us(call_elapsed);
 
-                if (format == ping_fping) {
-                    if (us < target->min) target->min = us;
-                    if (us > target->max) target->max = us;
-                    /* calculate the average time */
-                    target->avg = (target->avg * (target->received - 1) + us) / target->received;
-
-                    /* store the result for the final output */
-                    target->results[total_sent - 1] = us;
-                } else {
-                    hdr_record_value(target->histogram, us);
-                    /* TODO hdr_add()? */
-                    hdr_record_value(target->interval_histogram, us);
-                }
+                /* the next request to this target has been held up if this one took longer than the polling interval */
+                record_result(format, target, loop_count - 1, us, ts2us(sleep_time));
 
                 if (!quiet) {
                     /* use the start time for the call since some calls may not return */
@@ -987,19 +1974,15 @@ int main(int argc, char **argv) {
 
             /* check if we should print a periodic summary */
             /* This doesn't use an actual timer, it just sees if we've sent the expected number of packets based on the configured hertz. We should be pretty close. */
-            if (cfg.summary_interval && (loop_count % (hertz * cfg.summary_interval) == 0)) {
+            if (cfg.summary_interval && (loop_count % interval_rounds == 0)) {
                 print_interval(format, prefix, target, prognum_offset, version, wall_clock);
 
-                /* reset target counters */
-                target->sent = 0;
-                target->received = 0;
-                if (format == ping_fping) {
-                    target->min = ULONG_MAX;
-                    target->max = 0;
-                    target->avg = 0;
-                } else {
-                    hdr_reset(target->interval_histogram);
+                if (cfg.log) {
+                    log_interval(target, wall_clock);
                 }
+
+                /* reset target counters */
+                reset_interval(format, target);
             }
 
             /* see if we should disconnect and reconnect */
@@ -1023,8 +2006,8 @@ int main(int argc, char **argv) {
         /* at the end of the targets list, see if we need to loop */
         if (loop || (count && loop_count < count)) {
             /* sleep between rounds */
-            /* measure how long the current round took, and subtract that from the sleep time */
-            /* this tries to ensure that each polling round takes the same time */
+            /* each round is scheduled sleep_time after the start of the last one */
+            /* sleeping until an absolute time means the error in each sleep doesn't add up over time */
 #ifdef CLOCK_MONOTONIC_RAW
             clock_gettime(CLOCK_MONOTONIC_RAW, &loop_end);
 #else
@@ -1032,13 +2015,29 @@ int main(int argc, char **argv) {
 #endif
             timespecsub(&loop_end, &loop_start, &loop_elapsed);
             debug("Polling took %lld.%.9lds\n", (long long)loop_elapsed.tv_sec, loop_elapsed.tv_nsec);
+
+            timespecadd(&next_round, &sleep_time, &next_round);
+            /* clock_nanosleep() can't use CLOCK_MONOTONIC_RAW */
+            clock_gettime(CLOCK_MONOTONIC, &now);
+
             /* don't sleep if we went over the sleep_time */
-            if (timespeccmp(&loop_elapsed, &sleep_time, >)) {
+            if (timespeccmp(&now, &next_round, >=)) {
                 debug("Slow poll, not sleeping\n");
+                /* start the schedule again from now instead of trying to catch up */
+                next_round = now;
             } else {
-                timespecsub(&sleep_time, &loop_elapsed, &sleepy);
+                timespecsub(&next_round, &now, &sleepy);
                 debug("Sleeping for %lld.%.9lds\n", (long long)sleepy.tv_sec, sleepy.tv_nsec);
-                nanosleep(&sleepy, NULL);
+                sleep_until(&next_round, timespecisset(&cfg.spin) ? &cfg.spin : NULL);
+
+                /* see how close we got */
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                if (timespeccmp(&now, &next_round, >)) {
+                    timespecsub(&now, &next_round, &late);
+                    hdr_record_value(jitter, ts2ns(late));
+                } else {
+                    hdr_record_value(jitter, 0);
+                }
             }
 
             /* reset to start of target list */
@@ -1048,8 +2047,37 @@ int main(int argc, char **argv) {
 
     fflush(stdout);
 
+    if (engine) {
+        hdr_add(jitter, engine->jitter);
+        async_destroy(engine);
+    }
+
     /* print a format-specific summary at the end */
-    print_summary(format, total_sent, targets);
+    /* the synchronous loop, to compare with the asynchronous engine */
+    if (!async) {
+        stats.requests = total_sent;
+        stats.responses = total_recv;
+        print_cost("total", &stats, &last_cost);
+    }
+
+    print_memory(targets, target_count, baseline_rss);
+
+    print_summary(format, loop_count, targets);
+
+    /* the count or a signal cut the last interval short, log what was sent since the last summary */
+    if (cfg.log) {
+        clock_gettime(CLOCK_REALTIME, &wall_clock);
+        for (target = targets; target; target = target->next) {
+            if (target->sent) {
+                log_interval(target, wall_clock);
+            }
+        }
+        fclose(cfg.log);
+    }
+
+    if (cfg.jitter) {
+        print_jitter(jitter);
+    }
 
     /* exit with a failure if there were any missing responses */
     if (total_recv < total_sent) {
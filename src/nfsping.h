@@ -60,6 +60,11 @@
 /* unsigned long */
 /* polling frequency */
 #define NFS_HERTZ 10
+/* unsigned long */
+/* READ size when the server doesn't say what it prefers */
+#define NFS_BLOCKSIZE 8192
+/* the largest READ that fits in a UDP datagram */
+#define NFS_UDP_BLOCKSIZE 32768
 
 /* maximum number of digits that can fit in a 64 bit time_t seconds (long long int) for use with strftime() */
 /* 9223372036854775807 is LLONG_MAX, add one for a '-' (just in case!) and another for a terminating NUL */
@@ -72,21 +77,22 @@
 typedef struct targets {
     /* make the first field a pointer so that assigning to {0} works */
     CLIENT *client; /* RPC client */
-    char name[NI_MAXHOST]; /* from getnameinfo() */
-    char *ndqf; /* reversed name, for Graphite etc */
-    char ip_address[INET_ADDRSTRLEN]; /* the IP address as a string, from inet_ntop() */
-    char *display_name; /* pointer to which name string to use in output */
+    /* fields used for every request and response come first so they share cache lines */
+    /* the names are only needed for output and are at the end */
     /* TODO statically allocate */
     struct sockaddr_in *client_sock; /* used to store the port number and connect to the RPC client */
     /* for fping output when we need to store the individual results for the summary */
-    unsigned long *results;
+    /* in microseconds, 0 for a lost response */
+    uint32_t *results;
     unsigned int sent, received;
     unsigned long min, max;
     float avg;
-    /* histogram for each interval if using -Q */
-    struct hdr_histogram *interval_histogram;
     /* histogram for all results */
     struct hdr_histogram *histogram;
+    /* histogram for each interval if using -Q */
+    struct hdr_histogram *interval_histogram;
+    /* histogram of kernel timestamped response times if using -k (nfsping) */
+    struct hdr_histogram *wire_histogram;
     /* anonymous union to store different types of target data */
     /* TODO make for ping and fping (results etc) */
     /* TODO enum to specify type */
@@ -94,8 +100,21 @@ typedef struct targets {
         struct mount_exports *exports;
         struct nfs_fh_list   *filehandles;
     };
+    /* the end of the filehandle list, for appending */
+    struct nfs_fh_list *last_filehandle;
 
     struct targets *next;
+
+    /* time between requests to this target, zero to use the default (nfsping) */
+    struct timespec period;
+    /* size of each READ request to this target, from the command line or the server (nfscat) */
+    unsigned long blocksize;
+    /* wall clock time the current interval started, for the interval log (nfsping -o) */
+    struct timespec interval_start;
+    char *display_name; /* pointer to which name string to use in output */
+    char *ndqf; /* reversed name, for Graphite etc */
+    char ip_address[INET_ADDRSTRLEN]; /* the IP address as a string, from inet_ntop() */
+    char name[NI_MAXHOST]; /* from getnameinfo() */
 } targets_t;
 
 /* MOUNT protocol filesystem exports */
@@ -0,0 +1,1132 @@
+/* pipelined NFS READ requests */
+/* keeps a window of READs in flight instead of waiting for each reply before sending the next request */
+/* blocks can be striped across several connections to the same server, like the Linux nconnect mount option */
+/* replies are matched to requests by XID and handed back in offset order */
+/* or for random reads (read_any()) in the order they finish, for benchmarking */
+/* the data in each reply is received straight into a ring of page aligned buffers, which can be spliced into a pipe */
+
+#include "nfsping.h"
+#include "rpc.h"
+#include "util.h"
+#include "read.h"
+#include <netinet/tcp.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+
+/* globals */
+extern int verbose;
+
+
+/* allocate an engine for reading blocksize blocks with window requests in flight on each of the connections */
+/* the blocks are written to output with read_write(), or -1 if they aren't written anywhere */
+struct read_engine *read_init(count3 blocksize, unsigned int window, unsigned int connections, struct timeval timeout, int output) {
+    struct read_engine *engine = calloc(1, sizeof(struct read_engine));
+    long page_size = sysconf(_SC_PAGESIZE);
+    struct stat st;
+    int pipe_size;
+    unsigned int i;
+
+    if (engine == NULL) {
+        fatalx(3, "Couldn't allocate memory for read engine!\n");
+    }
+
+    engine->blocksize = blocksize;
+    /* blocks go to the connections in turn, so each one gets its share of the window */
+    engine->window = window * connections;
+    engine->connections = connections;
+    engine->timeout = timeout;
+    engine->expiry.tv_sec = timeout.tv_sec;
+    engine->expiry.tv_nsec = timeout.tv_usec * 1000;
+
+    engine->conns = calloc(connections, sizeof(struct read_conn));
+    engine->fds = calloc(connections, sizeof(struct pollfd));
+    if (engine->conns == NULL || engine->fds == NULL) {
+        fatalx(3, "Couldn't allocate memory for connections!\n");
+    }
+
+    for (i = 0; i < connections; i++) {
+        engine->conns[i].sock = -1;
+        /* from 1us up to the timeout */
+        if (hdr_init(1, tv2us(timeout), 3, &engine->conns[i].histogram)) {
+            fatalx(3, "Couldn't allocate memory for histograms!\n");
+        }
+    }
+
+    engine->xid_seq = getpid() ^ time(NULL);
+
+    while ((1U << engine->slot_bits) < engine->window) {
+        engine->slot_bits++;
+    }
+
+    engine->calls = calloc(engine->window, sizeof(struct read_call));
+    if (engine->calls == NULL) {
+        fatalx(3, "Couldn't allocate memory for read requests!\n");
+    }
+
+    for (i = 0; i < engine->window; i++) {
+        engine->calls[i].slot = i;
+    }
+
+    engine->output = output;
+    engine->ring_blocks = engine->window;
+    /* each block starts on a page boundary so vmsplice() can take whole pages */
+    engine->stride = (blocksize + page_size - 1) / page_size * page_size;
+
+    /* vmsplice() only puts references to the pages in the pipe, they can't be reused until they've been read out of it */
+    /* a block is only overwritten once enough blocks have been written after it to fill the pipe, and writing them waited for it to drain */
+    /* this only holds if the reader copies the data out, a reader that splices from the pipe could still be holding the pages */
+    if (output >= 0 && fstat(output, &st) == 0 && S_ISFIFO(st.st_mode)) {
+        pipe_size = fcntl(output, F_GETPIPE_SZ);
+        if (pipe_size > 0) {
+            engine->splice = 1;
+            engine->ring_blocks += (pipe_size + engine->stride - 1) / engine->stride + 1;
+        }
+    }
+
+    /* the memory used doesn't change however long the file is */
+    engine->ring_size = engine->ring_blocks * engine->stride;
+    engine->ring = mmap(NULL, engine->ring_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (engine->ring == MAP_FAILED) {
+        fatalx(3, "Couldn't allocate memory for read buffers!\n");
+    }
+
+    /* the call header, credentials, filehandle and arguments */
+    engine->request_size = 2 * READ_REPLY_HEADER;
+    engine->request = malloc(engine->request_size);
+
+    /* a whole reply has to fit for the replies that can't be received straight into the ring */
+    engine->reply_size = READ_REPLY_HEADER + blocksize;
+    engine->reply = malloc(engine->reply_size);
+
+    if (engine->request == NULL || engine->reply == NULL) {
+        fatalx(3, "Couldn't allocate memory for read engine!\n");
+    }
+
+    return engine;
+}
+
+
+/* set up a connection to read on from an RPC client */
+/* returns 0, or -1 on error */
+static int add_conn(struct read_conn *conn, CLIENT *client) {
+    struct sockaddr_in local;
+    socklen_t len = sizeof(conn->socktype);
+    int nodelay = 1;
+
+    conn->client = client;
+
+    /* send and receive on the client's socket without going through clnt_call() */
+    clnt_control(client, CLGET_FD, (char *)&conn->sock);
+    if (getsockopt(conn->sock, SOL_SOCKET, SO_TYPE, &conn->socktype, &len)) {
+        perror("add_conn(getsockopt)");
+        return -1;
+    }
+
+    /* the requests are small, don't let them wait for the replies to earlier ones to be acknowledged */
+    if (conn->socktype == SOCK_STREAM && setsockopt(conn->sock, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay))) {
+        perror("add_conn(setsockopt)");
+    }
+
+    len = sizeof(local);
+    if (getsockname(conn->sock, (struct sockaddr *)&local, &len) == 0) {
+        conn->port = ntohs(local.sin_port);
+    }
+
+    /* use the same credentials as the client */
+    conn->cred = client->cl_auth->ah_cred;
+    conn->verf = client->cl_auth->ah_verf;
+
+    return 0;
+}
+
+
+/* open the connections to a target */
+/* the first connection is the target's own client, which has to be connected already */
+/* each of the others is a new client with its own socket, so it comes from a different source port */
+/* the connections are kept until the next file is on a different target, or one of them breaks */
+/* returns 0, or -1 if any of them couldn't be opened */
+int read_connect(struct read_engine *engine, targets_t *target, struct addrinfo *hints, struct sockaddr_in src_ip) {
+    CLIENT *client;
+    unsigned int i;
+
+    /* the rest of a reply is still in the stream, so the client can't be used for anything else */
+    /* another target's client is made again by its next connect_target() */
+    if (engine->broken) {
+        engine->broken->client = destroy_rpc_client(engine->broken->client);
+        engine->broken = NULL;
+    }
+
+    if (engine->target == target && engine->stale == 0) {
+        return 0;
+    }
+
+    /* close the extra connections to the last target */
+    for (i = 1; i < engine->connections; i++) {
+        engine->conns[i].client = destroy_rpc_client(engine->conns[i].client);
+    }
+
+    engine->target = NULL;
+
+    /* the target's own client broke on the last file */
+    if (target->client == NULL) {
+        target->client = create_rpc_client_bufsize(target->client_sock, hints, NFS_PROGRAM, NFS_V3, engine->timeout, src_ip, 0, engine->blocksize + READ_REPLY_HEADER);
+        if (target->client == NULL) {
+            return -1;
+        }
+
+        /* don't use default AUTH_NONE */
+        auth_destroy(target->client->cl_auth);
+        /* set up AUTH_SYS */
+        target->client->cl_auth = authunix_create_default();
+    }
+
+    if (add_conn(&engine->conns[0], target->client)) {
+        return -1;
+    }
+
+    for (i = 1; i < engine->connections; i++) {
+        client = create_rpc_client(target->client_sock, hints, NFS_PROGRAM, NFS_V3, engine->timeout, src_ip);
+        if (client == NULL) {
+            return -1;
+        }
+
+        /* don't use default AUTH_NONE */
+        auth_destroy(client->cl_auth);
+        /* set up AUTH_SYS */
+        client->cl_auth = authunix_create_default();
+
+        if (add_conn(&engine->conns[i], client)) {
+            destroy_rpc_client(client);
+            return -1;
+        }
+    }
+
+    for (i = 0; i < engine->connections; i++) {
+        engine->fds[i].fd = engine->conns[i].sock;
+        engine->fds[i].events = POLLIN;
+    }
+
+    engine->target = target;
+    engine->stale = 0;
+
+    return 0;
+}
+
+
+/* start reading a file on the connections opened with read_connect() */
+/* count is the number of blocks to read, or 0 to read until the end of the file */
+void read_start(struct read_engine *engine, nfs_fh3 file, offset3 offset, unsigned long count) {
+    unsigned int i;
+
+    engine->file = file;
+    engine->start = offset;
+    engine->count = count;
+    engine->next_block = 0;
+    engine->head_block = 0;
+    engine->handed = 0;
+    engine->eof = 0;
+    engine->outstanding = 0;
+    engine->retries = READ_RETRIES;
+
+    /* replies to anything left over from the last file won't match */
+    for (i = 0; i < engine->window; i++) {
+        engine->calls[i].xid = 0;
+        engine->calls[i].done = 0;
+    }
+
+    for (i = 0; i < engine->connections; i++) {
+        hdr_reset(engine->conns[i].histogram);
+        engine->conns[i].reads = 0;
+        engine->conns[i].bytes = 0;
+    }
+}
+
+
+/* the XID is the first word of every RPC message */
+static uint32_t get_xid(const char *buf) {
+    uint32_t xid;
+
+    memcpy(&xid, buf, sizeof(xid));
+
+    return ntohl(xid);
+}
+
+
+/* send a READ request for the rest of a call's block */
+/* returns 0, or -1 if the request couldn't be sent */
+static int send_call(struct read_engine *engine, struct read_call *call) {
+    XDR xdrs;
+    struct rpc_msg msg = {
+        .rm_direction = CALL,
+    };
+    READ3args args = {
+        .file = engine->file,
+        .offset = call->offset + call->len,
+        .count = call->count - call->len,
+    };
+    struct read_conn *conn = call->conn;
+    /* TCP requests start with a record mark */
+    u_int mark = conn->socktype == SOCK_STREAM ? BYTES_PER_XDR_UNIT : 0;
+    u_int len = 0;
+    uint32_t word;
+
+    /* a resend after a timeout keeps its XID so a late reply to the first request still counts */
+    if (call->xid == 0) {
+        call->xid = (engine->xid_seq++ << engine->slot_bits) | call->slot;
+        call->retries = 0;
+        engine->outstanding++;
+    }
+
+    msg.rm_xid = call->xid;
+    msg.rm_call.cb_rpcvers = RPC_MSG_VERSION;
+    msg.rm_call.cb_prog = NFS_PROGRAM;
+    msg.rm_call.cb_vers = NFS_V3;
+    msg.rm_call.cb_proc = NFSPROC3_READ;
+    msg.rm_call.cb_cred = conn->cred;
+    msg.rm_call.cb_verf = conn->verf;
+
+    xdrmem_create(&xdrs, engine->request + mark, engine->request_size - mark, XDR_ENCODE);
+
+    if (xdr_callmsg(&xdrs, &msg) && xdr_READ3args(&xdrs, &args)) {
+        len = xdr_getpos(&xdrs);
+    }
+
+    xdr_destroy(&xdrs);
+
+    if (len == 0) {
+        call->status = RPC_CANTENCODEARGS;
+        return -1;
+    }
+
+    /* one fragment with the last fragment bit set */
+    if (mark) {
+        word = htonl(0x80000000 | len);
+        memcpy(engine->request, &word, sizeof(word));
+    }
+
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, &call->sent);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &call->sent);
+#endif
+
+    /* requests sent later time out later, so only the first one in flight moves the deadline */
+    if (engine->outstanding == 1) {
+        timespecadd(&call->sent, &engine->expiry, &engine->deadline);
+    }
+
+    if (send(conn->sock, engine->request, len + mark, 0) != (ssize_t)(len + mark)) {
+        perror("send_call(send)");
+        call->status = RPC_CANTSEND;
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/* finish a call without a reply */
+static void fail_call(struct read_engine *engine, struct read_call *call, enum clnt_stat status) {
+    /* replies to it won't match now */
+    if (call->xid) {
+        call->xid = 0;
+        engine->outstanding--;
+    }
+
+    call->status = status;
+    call->done = 1;
+}
+
+
+/* start the request for a block in a call slot */
+static void start_call(struct read_engine *engine, struct read_call *call, unsigned long block, struct read_conn *conn) {
+    call->block = block;
+    call->conn = conn;
+    call->offset = engine->start + block * engine->blocksize;
+    call->count = engine->blocksize;
+    call->len = 0;
+    call->eof = FALSE;
+    call->done = 0;
+    call->us = 0;
+    call->status = RPC_SUCCESS;
+    call->nfs_status = NFS3_OK;
+
+    if (send_call(engine, call)) {
+        fail_call(engine, call, call->status);
+    }
+}
+
+
+/* start the request for the next block in the file */
+static void send_block(struct read_engine *engine, unsigned long block) {
+    struct read_call *call = &engine->calls[block % engine->window];
+
+    call->data = engine->ring + (block % engine->ring_blocks) * engine->stride;
+    /* stripe the blocks across the connections */
+    start_call(engine, call, block, &engine->conns[block % engine->connections]);
+}
+
+
+/* a READ reply up to the start of its data */
+struct read_header {
+    struct read_call *call;
+    /* length of the data that follows */
+    u_int len;
+};
+
+
+/* decode the results of a READ reply as far as the data so it can be received into the call's buffer */
+/* the attributes aren't kept */
+static bool_t xdr_read_header(XDR *xdrs, struct read_header *header) {
+    struct read_call *call = header->call;
+    post_op_attr attributes;
+    count3 count;
+
+    if (!xdr_nfsstat3(xdrs, &call->nfs_status) || !xdr_post_op_attr(xdrs, &attributes)) {
+        return FALSE;
+    }
+
+    if (call->nfs_status != NFS3_OK) {
+        return TRUE;
+    }
+
+    if (!xdr_count3(xdrs, &count) || !xdr_bool(xdrs, &call->eof) || !xdr_u_int(xdrs, &header->len)) {
+        return FALSE;
+    }
+
+    /* don't let the server write past the end of the block */
+    if (header->len > call->count - call->len) {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+
+/* find the call waiting for a reply from its XID */
+/* returns NULL if nothing is waiting for it */
+static struct read_call *find_call(struct read_engine *engine, const char *buf, size_t len) {
+    struct read_call *call;
+    uint32_t xid;
+
+    if (len < BYTES_PER_XDR_UNIT) {
+        return NULL;
+    }
+
+    xid = get_xid(buf);
+    if ((xid & ((1U << engine->slot_bits) - 1)) >= engine->window) {
+        return NULL;
+    }
+
+    call = &engine->calls[xid & ((1U << engine->slot_bits) - 1)];
+
+    /* a late reply to a call that has already been finished or resent */
+    if (call->xid == 0 || call->xid != xid) {
+        debug("Ignoring reply with XID %u\n", xid);
+        return NULL;
+    }
+
+    return call;
+}
+
+
+/* decode the headers at the start of a reply and set the call's status */
+/* the length of the data is returned in len, which is 0 unless the read succeeded */
+/* returns the offset of the data in the reply, or -1 if the headers couldn't be decoded from buf */
+static ssize_t decode_header(struct read_call *call, char *buf, size_t buflen, u_int *len) {
+    XDR xdrs;
+    char verf[MAX_AUTH_BYTES];
+    struct read_header header = {
+        .call = call,
+    };
+    struct rpc_msg msg = {
+        .acpted_rply.ar_verf = {
+            .oa_base = verf,
+        },
+        .acpted_rply.ar_results = {
+            .where = (caddr_t)&header,
+            .proc = (xdrproc_t)xdr_read_header,
+        },
+    };
+    struct rpc_err err;
+    ssize_t offset = -1;
+
+    *len = 0;
+
+    xdrmem_create(&xdrs, buf, buflen, XDR_DECODE);
+    if (xdr_replymsg(&xdrs, &msg)) {
+        offset = xdr_getpos(&xdrs);
+    }
+    xdr_destroy(&xdrs);
+
+    if (offset == -1) {
+        call->status = RPC_CANTDECODERES;
+        return -1;
+    }
+
+    _seterr_reply(&msg, &err);
+    call->status = err.re_status;
+
+    if (call->status == RPC_SUCCESS && call->nfs_status == NFS3_OK) {
+        *len = header.len;
+    }
+
+    return offset;
+}
+
+
+/* finish a call once its reply has been received, with len bytes of data added to the block */
+static void finish_call(struct read_engine *engine, struct read_call *call, u_int len) {
+    struct timespec now, elapsed;
+
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+    timespecsub(&now, &call->sent, &elapsed);
+    call->us = ts2us(elapsed);
+
+    call->xid = 0;
+    engine->outstanding--;
+
+    call->len += len;
+
+    /* the server sent less than was asked for, ask for the rest of the block */
+    if (call->status == RPC_SUCCESS && call->nfs_status == NFS3_OK && call->eof == FALSE && call->len < call->count && len) {
+        if (send_call(engine, call) == 0) {
+            return;
+        }
+        fail_call(engine, call, call->status);
+        return;
+    }
+
+    call->done = 1;
+
+    /* nothing past the end of the file is sent or handed back */
+    if (call->status == RPC_SUCCESS && call->nfs_status == NFS3_OK && call->eof) {
+        if (engine->eof == 0 || call->block < engine->eof_block) {
+            engine->eof = 1;
+            engine->eof_block = call->block;
+        }
+    }
+}
+
+
+/* handle a whole reply that has been read into a buffer, copying its data into the call's block */
+static void handle_reply(struct read_engine *engine, char *buf, size_t buflen) {
+    struct read_call *call = find_call(engine, buf, buflen);
+    ssize_t offset;
+    u_int len;
+
+    if (call == NULL) {
+        return;
+    }
+
+    offset = decode_header(call, buf, buflen, &len);
+    if (offset == -1 || (size_t)offset + len > buflen) {
+        call->status = RPC_CANTDECODERES;
+        len = 0;
+    } else {
+        memcpy(call->data + call->len, buf + offset, len);
+    }
+
+    finish_call(engine, call, len);
+}
+
+
+/* time out the requests that haven't had a reply within the timeout */
+/* UDP requests are sent again a few times first in case the request or the reply was lost */
+/* the calls are only looked at once the earliest deadline has passed */
+static void expire_calls(struct read_engine *engine) {
+    struct timespec now, deadline;
+    struct read_call *call;
+    unsigned int i;
+    int first = 1;
+
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+
+    if (engine->outstanding == 0 || timespeccmp(&now, &engine->deadline, <)) {
+        return;
+    }
+
+    for (i = 0; i < engine->window; i++) {
+        call = &engine->calls[i];
+        if (call->xid == 0) {
+            continue;
+        }
+
+        timespecadd(&call->sent, &engine->expiry, &deadline);
+
+        if (timespeccmp(&now, &deadline, >=)) {
+            /* TCP doesn't lose requests, a late reply means the server is stuck */
+            if (call->conn->socktype == SOCK_STREAM || call->retries >= engine->retries) {
+                fail_call(engine, call, RPC_TIMEDOUT);
+                continue;
+            }
+
+            call->retries++;
+            debug("Resending READ for offset %" PRIu64 "\n", (uint64_t)(call->offset + call->len));
+            if (send_call(engine, call)) {
+                fail_call(engine, call, call->status);
+                continue;
+            }
+            timespecadd(&call->sent, &engine->expiry, &deadline);
+        }
+
+        /* the deadline left over from a call that has finished can be too early, this corrects it */
+        if (first || timespeccmp(&deadline, &engine->deadline, <)) {
+            engine->deadline = deadline;
+            first = 0;
+        }
+    }
+}
+
+
+/* wait until the next deadline for any of the connections to be readable */
+/* returns the number of readable connections, 0 on timeout, -1 on error */
+static int wait_readable(struct read_engine *engine) {
+    struct timespec now, left;
+    int ms = engine->timeout.tv_sec * 1000 + engine->timeout.tv_usec / 1000;
+    int ready;
+
+    if (engine->outstanding) {
+#ifdef CLOCK_MONOTONIC_RAW
+        clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+#else
+        clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+        if (timespeccmp(&now, &engine->deadline, <)) {
+            timespecsub(&engine->deadline, &now, &left);
+            /* round up so it doesn't wake up just before the deadline */
+            ms = left.tv_sec * 1000 + (left.tv_nsec + 999999) / 1000000;
+        } else {
+            ms = 0;
+        }
+    }
+
+    do {
+        ready = poll(engine->fds, engine->connections, ms);
+    } while (ready == -1 && errno == EINTR);
+
+    if (ready == -1) {
+        perror("wait_readable(poll)");
+    }
+
+    return ready;
+}
+
+
+/* read exactly len bytes from a TCP connection */
+/* returns 0, or -1 on error or timeout */
+static int recv_all(struct read_engine *engine, struct read_conn *conn, char *buf, size_t len) {
+    struct pollfd fds = {
+        .fd = conn->sock,
+        .events = POLLIN,
+    };
+    ssize_t n;
+
+    while (len) {
+        n = recv(conn->sock, buf, len, MSG_DONTWAIT);
+        if (n == -1 && (errno == EAGAIN || errno == EINTR)) {
+            /* wait for the rest of the reply */
+            if (poll(&fds, 1, engine->timeout.tv_sec * 1000 + engine->timeout.tv_usec / 1000) <= 0) {
+                return -1;
+            }
+            continue;
+        }
+
+        if (n <= 0) {
+            return -1;
+        }
+
+        buf += n;
+        len -= n;
+    }
+
+    return 0;
+}
+
+
+/* read one UDP reply */
+/* the start of the datagram is peeked at to find the call and where the data starts */
+/* then it's read with the data going straight into the call's block */
+/* returns 0, or -1 on error */
+static int recv_datagram(struct read_engine *engine, struct read_conn *conn) {
+    struct read_call *call;
+    struct iovec iov[3];
+    struct msghdr msg = {
+        .msg_iov = iov,
+        .msg_iovlen = 3,
+    };
+    ssize_t n, offset = -1;
+    size_t peek;
+    u_int len = 0;
+
+    n = recv(conn->sock, engine->reply, READ_PEEK, MSG_PEEK | MSG_TRUNC);
+    if (n == -1) {
+        return errno == EINTR ? 0 : -1;
+    }
+
+    peek = (size_t)n < READ_PEEK ? (size_t)n : READ_PEEK;
+
+    call = find_call(engine, engine->reply, peek);
+    if (call) {
+        offset = decode_header(call, engine->reply, peek, &len);
+    }
+
+    if (offset == -1 || offset + len > n || (size_t)(n - len) > engine->reply_size) {
+        /* not ours, or the headers didn't fit in the peek, read the whole thing the usual way */
+        n = recv(conn->sock, engine->reply, engine->reply_size, MSG_TRUNC);
+        if (n == -1) {
+            return errno == EINTR ? 0 : -1;
+        }
+
+        /* too big for the buffer, can't be one of ours */
+        if ((size_t)n <= engine->reply_size) {
+            handle_reply(engine, engine->reply, n);
+        }
+
+        return 0;
+    }
+
+    /* the headers, the data, then any padding */
+    iov[0].iov_base = engine->reply;
+    iov[0].iov_len = offset;
+    iov[1].iov_base = call->data + call->len;
+    iov[1].iov_len = len;
+    iov[2].iov_base = engine->reply + offset;
+    iov[2].iov_len = n - offset - len;
+
+    if (recvmsg(conn->sock, &msg, 0) != n) {
+        return -1;
+    }
+
+    finish_call(engine, call, len);
+
+    return 0;
+}
+
+
+/* read one TCP reply */
+/* replies are made up of fragments, each starting with a record mark */
+/* a reply in one fragment has its headers read first, then its data goes straight into the call's block */
+/* replies in several fragments are put back together in the reply buffer and copied */
+/* returns 0, or -1 on error */
+static int recv_record(struct read_engine *engine, struct read_conn *conn) {
+    struct read_call *call;
+    uint32_t mark;
+    size_t len = 0, fragment, peek, have;
+    ssize_t offset = -1;
+    u_int data = 0;
+
+    if (recv_all(engine, conn, (char *)&mark, sizeof(mark))) {
+        return -1;
+    }
+
+    mark = ntohl(mark);
+    fragment = mark & 0x7fffffff;
+
+    if (mark & 0x80000000) {
+        peek = fragment < READ_PEEK ? fragment : READ_PEEK;
+
+        if (recv_all(engine, conn, engine->reply, peek)) {
+            return -1;
+        }
+
+        call = find_call(engine, engine->reply, peek);
+        if (call) {
+            offset = decode_header(call, engine->reply, peek, &data);
+        }
+
+        if (offset != -1 && (size_t)offset + data <= fragment && fragment - data <= engine->reply_size) {
+            /* some of the data may have come in with the headers */
+            have = peek - offset < data ? peek - offset : data;
+            memcpy(call->data + call->len, engine->reply + offset, have);
+
+            if (recv_all(engine, conn, call->data + call->len + have, data - have)) {
+                return -1;
+            }
+
+            /* then the padding after the data, unless it came in with the headers */
+            have = (size_t)offset + data > peek ? (size_t)offset + data : peek;
+            if (recv_all(engine, conn, engine->reply, fragment - have)) {
+                return -1;
+            }
+
+            finish_call(engine, call, data);
+
+            return 0;
+        }
+
+        /* fall back to reading the rest of the reply into the buffer */
+        len = peek;
+        fragment -= peek;
+    }
+
+    while (1) {
+        /* the stream can't be followed past a reply that doesn't fit */
+        if (len + fragment > engine->reply_size) {
+            fprintf(stderr, "READ reply too large!\n");
+            return -1;
+        }
+
+        if (recv_all(engine, conn, engine->reply + len, fragment)) {
+            return -1;
+        }
+
+        len += fragment;
+
+        if (mark & 0x80000000) {
+            break;
+        }
+
+        if (recv_all(engine, conn, (char *)&mark, sizeof(mark))) {
+            return -1;
+        }
+
+        mark = ntohl(mark);
+        fragment = mark & 0x7fffffff;
+    }
+
+    handle_reply(engine, engine->reply, len);
+
+    return 0;
+}
+
+
+/* record a call's round trip time in a histogram that goes up to the timeout */
+void read_record(struct hdr_histogram *histogram, const struct read_call *call) {
+    /* a reply can be handled just after its deadline, before expire_calls() gets to it */
+    hdr_record_value(histogram, (int64_t)call->us < histogram->highest_trackable_value ? (int64_t)call->us : histogram->highest_trackable_value);
+}
+
+
+/* add a finished call to its connection's statistics */
+static void record_call(struct read_call *call) {
+    if (call->status == RPC_SUCCESS && call->nfs_status == NFS3_OK) {
+        read_record(call->conn->histogram, call);
+        call->conn->reads++;
+        call->conn->bytes += call->len;
+    }
+}
+
+
+/* read one reply from each of the connections that poll() said were readable */
+/* returns 0, or -1 if any of them broke, they can't be followed any further */
+static int recv_ready(struct read_engine *engine) {
+    struct read_conn *conn;
+    unsigned int i;
+    int status = 0;
+
+    for (i = 0; i < engine->connections; i++) {
+        if (engine->fds[i].revents == 0) {
+            continue;
+        }
+
+        conn = &engine->conns[i];
+        if ((conn->socktype == SOCK_STREAM ? recv_record(engine, conn) : recv_datagram(engine, conn))) {
+            status = -1;
+
+            /* a TCP reply that was only partly read leaves the stream out of step */
+            /* so the connections are opened again for the next file instead of reading on from the middle of it */
+            if (conn->socktype == SOCK_STREAM) {
+                engine->stale = 1;
+                if (i == 0) {
+                    engine->broken = engine->target;
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
+
+/* get the next block of the file in offset order */
+/* keeps the window full while it waits for the block's reply */
+/* the block stays valid until the next call */
+/* returns NULL at the end of the file or the count */
+/* otherwise check the status of the block, the caller should stop reading after an error */
+struct read_call *read_next(struct read_engine *engine) {
+    struct read_call *call;
+    int ready;
+
+    /* the last block has been used, its slot can take a new request */
+    if (engine->handed) {
+        engine->handed = 0;
+        engine->head_block++;
+    }
+
+    while (1) {
+        if ((engine->eof && engine->head_block > engine->eof_block) || (engine->count && engine->head_block >= engine->count)) {
+            return NULL;
+        }
+
+        /* keep the window full */
+        while (engine->next_block < engine->head_block + engine->window
+            && (engine->eof == 0 || engine->next_block <= engine->eof_block)
+            && (engine->count == 0 || engine->next_block < engine->count)) {
+            send_block(engine, engine->next_block++);
+        }
+
+        call = &engine->calls[engine->head_block % engine->window];
+
+        if (call->done) {
+            engine->handed = 1;
+
+            /* only count the blocks that are handed back, not the ones past the end of the file */
+            record_call(call);
+
+            return call;
+        }
+
+        /* one reply from each connection that has something, stop at the oldest block if one breaks */
+        ready = wait_readable(engine);
+        if ((ready == -1 || (ready > 0 && recv_ready(engine))) && call->done == 0) {
+            fail_call(engine, call, RPC_CANTRECV);
+        }
+
+        /* each request gets the whole timeout, however busy the other connections are */
+        expire_calls(engine);
+    }
+}
+
+
+/* a hash to spread the most popular zipf ranks over the file */
+/* the splitmix64 finaliser */
+static uint64_t hash_rank(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+
+    return x;
+}
+
+
+/* the generalised harmonic number, the sum of 1 / i^theta for i = 1..n */
+/* after READ_ZETA_TERMS the rest of the sum is estimated with its integral */
+static double zeta(unsigned long n, double theta) {
+    unsigned long terms = n < READ_ZETA_TERMS ? n : READ_ZETA_TERMS;
+    double sum = 0;
+    unsigned long i;
+
+    for (i = 1; i <= terms; i++) {
+        sum += 1 / pow(i, theta);
+    }
+
+    if (n > terms) {
+        sum += (pow(n, 1 - theta) - pow(terms, 1 - theta)) / (1 - theta);
+    }
+
+    return sum;
+}
+
+
+/* pick a random block from the distribution */
+static unsigned long pick_block(struct read_engine *engine) {
+    double u = erand48(engine->xsubi);
+    double theta = engine->random.theta;
+    unsigned long hot;
+    unsigned long block;
+
+    switch (engine->random.pattern) {
+        case read_zipf:
+            /* from Gray et al, "Quickly Generating Billion-Record Synthetic Databases" */
+            if (u * engine->zetan < 1) {
+                block = 0;
+            } else if (u * engine->zetan < 1 + pow(0.5, theta)) {
+                block = 1;
+            } else {
+                block = engine->blocks * pow(engine->eta * u - engine->eta + 1, 1 / (1 - theta));
+            }
+            /* otherwise the hottest blocks would all be at the start of the file */
+            return hash_rank(block) % engine->blocks;
+        case read_hotset:
+            hot = engine->blocks * engine->random.hot_blocks;
+            if (hot == 0) {
+                hot = 1;
+            }
+            if (hot < engine->blocks && u >= engine->random.hot_reads) {
+                block = hot + (engine->blocks - hot) * erand48(engine->xsubi);
+            } else {
+                block = hot * erand48(engine->xsubi);
+            }
+            break;
+        case read_uniform:
+        default:
+            block = engine->blocks * u;
+            break;
+    }
+
+    /* rounding can land on the end */
+    return block < engine->blocks ? block : engine->blocks - 1;
+}
+
+
+/* start random reads of the whole blocks in a file of size bytes */
+/* the file is read with read_any() until the caller stops */
+void read_random(struct read_engine *engine, nfs_fh3 file, size3 size, const struct read_random *random) {
+    unsigned int i;
+
+    read_start(engine, file, 0, 0);
+
+    /* a lost request is counted as a timeout instead of being hidden by a resend */
+    engine->retries = 0;
+
+    engine->random = *random;
+    engine->blocks = size / engine->blocksize;
+    /* a file smaller than a block is read from the start */
+    if (engine->blocks == 0) {
+        engine->blocks = 1;
+    }
+
+    engine->xsubi[0] = getpid();
+    engine->xsubi[1] = time(NULL);
+    engine->xsubi[2] = engine->xid_seq;
+
+    /* the zipf formula needs more than two blocks */
+    if (engine->random.pattern == read_zipf) {
+        if (engine->blocks > 2) {
+            engine->zetan = zeta(engine->blocks, engine->random.theta);
+            engine->eta = (1 - pow(2.0 / engine->blocks, 1 - engine->random.theta)) / (1 - (1 + pow(0.5, engine->random.theta)) / engine->zetan);
+        } else {
+            engine->random.pattern = read_uniform;
+        }
+    }
+
+    engine->last = NULL;
+    engine->scan = 0;
+
+    /* every call slot has a buffer of its own, there's no order to keep */
+    for (i = 0; i < engine->window; i++) {
+        engine->calls[i].data = engine->ring + i * engine->stride;
+        engine->calls[i].xid = 0;
+        engine->calls[i].done = 0;
+    }
+
+    /* fill the window */
+    for (i = 0; i < engine->window; i++) {
+        start_call(engine, &engine->calls[i], pick_block(engine), &engine->conns[engine->next_block++ % engine->connections]);
+    }
+}
+
+
+/* get the next random read to finish, in the order they finish rather than in offset order */
+/* the call that was handed back last time gets a new request so the window stays full */
+/* the block stays valid until the next call */
+/* check the status of the block, timed out requests are handed back with RPC_TIMEDOUT */
+struct read_call *read_any(struct read_engine *engine) {
+    struct read_call *call, *oldest;
+    unsigned int i;
+    int ready;
+
+    if (engine->last) {
+        start_call(engine, engine->last, pick_block(engine), &engine->conns[engine->next_block++ % engine->connections]);
+        engine->last = NULL;
+    }
+
+    while (1) {
+        for (i = 0; i < engine->window; i++) {
+            call = &engine->calls[(engine->scan + i) % engine->window];
+
+            if (call->done) {
+                engine->scan = (call->slot + 1) % engine->window;
+                engine->last = call;
+                record_call(call);
+                return call;
+            }
+        }
+
+        /* one reply from each connection that has something, a broken one fails the request that has waited the longest */
+        ready = wait_readable(engine);
+        if (ready == -1 || (ready > 0 && recv_ready(engine))) {
+            oldest = NULL;
+            for (i = 0; i < engine->window; i++) {
+                call = &engine->calls[i];
+                if (call->xid && (oldest == NULL || timespeccmp(&call->sent, &oldest->sent, <))) {
+                    oldest = call;
+                }
+            }
+
+            if (oldest) {
+                fail_call(engine, oldest, RPC_CANTRECV);
+            }
+        }
+
+        /* every request times out on its own, however many other replies keep arriving */
+        expire_calls(engine);
+    }
+}
+
+
+/* write a block that read_next() handed back to the output */
+/* pipes get references to the block's pages instead of a copy */
+/* returns 0, or -1 on error */
+int read_write(struct read_engine *engine, const struct read_call *call) {
+    struct iovec iov = {
+        .iov_base = call->data,
+        .iov_len = call->len,
+    };
+    ssize_t n;
+
+    while (iov.iov_len) {
+        if (engine->splice) {
+            n = vmsplice(engine->output, &iov, 1, 0);
+            /* not supported, copy it instead */
+            if (n == -1 && (errno == EINVAL || errno == ENOSYS)) {
+                engine->splice = 0;
+                continue;
+            }
+        } else {
+            n = write(engine->output, iov.iov_base, iov.iov_len);
+        }
+
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("read_write");
+            return -1;
+        }
+
+        iov.iov_base = (char *)iov.iov_base + n;
+        iov.iov_len -= n;
+    }
+
+    return 0;
+}
+
+
+void read_destroy(struct read_engine *engine) {
+    unsigned int i;
+
+    /* the first connection belongs to the target, unless it broke */
+    if (engine->broken) {
+        engine->broken->client = destroy_rpc_client(engine->broken->client);
+    }
+
+    for (i = 0; i < engine->connections; i++) {
+        if (i) {
+            destroy_rpc_client(engine->conns[i].client);
+        }
+        free(engine->conns[i].histogram);
+    }
+
+    free(engine->conns);
+    free(engine->fds);
+
+    munmap(engine->ring, engine->ring_size);
+    free(engine->calls);
+    free(engine->request);
+    free(engine->reply);
+    free(engine);
+}
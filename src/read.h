@@ -0,0 +1,172 @@
+#ifndef READ_H
+#define READ_H
+
+#include "nfsping.h"
+#include <poll.h>
+
+/* most READ requests that can be in flight on a connection */
+#define READ_WINDOW_MAX 1024
+
+/* most connections to stripe reads across */
+#define READ_CONNECTIONS_MAX 64
+
+/* number of times read_next() sends a UDP request again when its reply doesn't come back within the timeout */
+#define READ_RETRIES 3
+
+/* space for the RPC and NFS headers in front of the data in each reply */
+/* a verifier can be up to 400 bytes and the post op attributes are another 88 */
+#define READ_REPLY_HEADER 1024
+
+/* how much of each reply to look at to find where the data starts */
+/* enough for the usual headers, replies with bigger ones are read into the reply buffer and copied */
+#define READ_PEEK 256
+
+/* zipfian random reads add up this many terms of the zeta function, the rest of a bigger file is estimated */
+#define READ_ZETA_TERMS 10000000
+
+/* how random reads pick blocks */
+enum read_patterns {
+    /* every block is as likely */
+    read_uniform,
+    /* a few blocks get most of the reads, like a cache workload */
+    read_zipf,
+    /* hot_reads of the reads go to the first hot_blocks of the file */
+    read_hotset,
+};
+
+struct read_random {
+    enum read_patterns pattern;
+    /* zipf skew, between 0 and 1 */
+    double theta;
+    /* hotset fractions of the file and of the reads */
+    double hot_blocks;
+    double hot_reads;
+};
+
+/* a READ request in the window */
+struct read_call {
+    /* XID of the request in flight, 0 if it isn't waiting for a reply */
+    uint32_t xid;
+    /* the call's slot number, which makes up the low bits of the XID */
+    unsigned int slot;
+    /* the block this slot is reading, counting from the start offset */
+    unsigned long block;
+    /* the connection the block is read on */
+    struct read_conn *conn;
+    offset3 offset;
+    count3 count;
+    /* set once the block has been read or failed */
+    int done;
+    /* the time the last request for the block was sent and the round trip time of its reply */
+    struct timespec sent;
+    unsigned long us;
+    /* number of times the request has been sent again after timing out */
+    unsigned int retries;
+    /* RPC_SUCCESS if the server replied, then the NFS status of the reply */
+    enum clnt_stat status;
+    nfsstat3 nfs_status;
+    /* the block's buffer in the ring, replies are received straight into it */
+    /* short reads are sent again for the rest of the block, len is how much has come back so far */
+    char *data;
+    count3 len;
+    bool_t eof;
+};
+
+/* one of the connections blocks are striped across */
+struct read_conn {
+    CLIENT *client;
+    int sock;
+    int socktype;
+    /* the local port, each connection has its own */
+    uint16_t port;
+    /* credentials from the RPC client, the XID is different for each request */
+    struct opaque_auth cred;
+    struct opaque_auth verf;
+    /* round trip times of the reads on this connection for the current file */
+    struct hdr_histogram *histogram;
+    unsigned long reads;
+    unsigned long long bytes;
+};
+
+struct read_engine {
+    /* the target the connections are open to */
+    targets_t *target;
+    /* set when a TCP connection breaks partway through a reply, the connections are opened again for the next file */
+    int stale;
+    /* the target whose own client broke, it's replaced before it's used again */
+    targets_t *broken;
+    /* the first connection is the target's own client, the rest are opened by the engine */
+    struct read_conn *conns;
+    unsigned int connections;
+    struct pollfd *fds;
+    struct timeval timeout;
+    /* the timeout as a timespec for adding to send times */
+    struct timespec expiry;
+    /* no request in flight times out before this, the calls are only checked once it has passed */
+    struct timespec deadline;
+    /* number of times a UDP request is sent again before it times out */
+    unsigned int retries;
+    count3 blocksize;
+    /* number of requests to keep in flight on all connections */
+    unsigned int window;
+    /* the low bits of each XID are the call slot */
+    unsigned int slot_bits;
+    /* high bits of the XID, incremented for each request */
+    uint32_t xid_seq;
+    /* one call slot for each block in the window, reused in order */
+    struct read_call *calls;
+    /* the file being read */
+    nfs_fh3 file;
+    offset3 start;
+    /* number of blocks to read, 0 = until the end of the file */
+    unsigned long count;
+    /* number of requests waiting for replies, the calls with an XID */
+    unsigned long outstanding;
+    /* the next block to send a request for, and the next block to hand back */
+    unsigned long next_block;
+    unsigned long head_block;
+    /* the head block has been handed back and can be reused on the next call to read_next() */
+    int handed;
+    /* set once a reply reaches the end of the file, no blocks past eof_block are sent or handed back */
+    int eof;
+    unsigned long eof_block;
+    /* requests are encoded here, with space for the TCP record mark */
+    char *request;
+    u_int request_size;
+    /* the headers of each reply are read here, whole replies only when the data can't be received straight into the ring */
+    char *reply;
+    size_t reply_size;
+    /* page aligned buffers for the blocks, block n goes in buffer n % ring_blocks */
+    /* there are more buffers than calls so blocks that have been spliced into a pipe aren't overwritten while they're still in it */
+    char *ring;
+    size_t ring_size;
+    size_t stride;
+    unsigned long ring_blocks;
+    /* where the blocks are written, -1 if they aren't */
+    int output;
+    /* move the pages into the output pipe with vmsplice() instead of copying them with write() */
+    int splice;
+    /* random reads with read_any() */
+    struct read_random random;
+    /* number of whole blocks in the file to pick from */
+    unsigned long blocks;
+    unsigned short xsubi[3];
+    /* zipf constants that only depend on the number of blocks */
+    double zetan, eta;
+    /* the call handed back by read_any(), it gets a new request on the next call */
+    struct read_call *last;
+    /* read_any() looks for finished calls from here so they're handed back fairly */
+    unsigned int scan;
+};
+
+struct read_engine *read_init(count3, unsigned int, unsigned int, struct timeval, int);
+int read_connect(struct read_engine *, targets_t *, struct addrinfo *, struct sockaddr_in);
+void read_start(struct read_engine *, nfs_fh3, offset3, unsigned long);
+struct read_call *read_next(struct read_engine *);
+void read_random(struct read_engine *, nfs_fh3, size3, const struct read_random *);
+struct read_call *read_any(struct read_engine *);
+void read_record(struct hdr_histogram *, const struct read_call *);
+int read_write(struct read_engine *, const struct read_call *);
+void read_destroy(struct read_engine *);
+
+#endif /* READ_H */
@@ -60,140 +60,205 @@ CLIENT *destroy_rpc_client(CLIENT *client) {
 }
 
 
-/* create an RPC client */
-/* takes an initialised sockaddr_in with the address and port */
-/* returns an initialised client, or NULL on error */
-CLIENT *create_rpc_client(struct sockaddr_in *client_sock, struct addrinfo *hints, unsigned long prognum, unsigned long version, struct timeval timeout, struct sockaddr_in src_ip) {
+/* look up a program's port using the portmapper on the server */
+/* makes its own portmapper connection and closes it afterwards */
+/* returns the port in network byte order, or 0 on error */
+uint16_t portmap_lookup(struct sockaddr_in *client_sock, struct addrinfo *hints, unsigned long prognum, unsigned long version, struct timeval timeout, struct sockaddr_in src_ip) {
     CLIENT *client = NULL;
     int sock;
+    uint16_t port;
     long unsigned protocol; /* for portmapper */
     char src[INET_ADDRSTRLEN];
     char dst[INET_ADDRSTRLEN];
     struct sockaddr_in getaddr; /* for getsockname */
     socklen_t len = sizeof(getaddr);
+    /* make a copy so we don't clobber the caller's port */
+    struct sockaddr_in pmap_sock = *client_sock;
 
     /* Even if you specify a source address the portmapper will use the default one */
     /* this applies to pmap_getport or clnt*_create */
     /* so use our own get_rpc_port */
+    pmap_sock.sin_port = htons(PMAPPORT); /* 111 */
 
-    /* check if we need to use the portmapper, 0 = yes */
-    if (client_sock->sin_port == 0) {
-        client_sock->sin_port = htons(PMAPPORT); /* 111 */
-
-        sock = socket(AF_INET, hints->ai_socktype, 0);
-        if (sock < 0) {
-            perror("create_rpc_client(socket)");
-            return NULL;
-        }
+    sock = socket(AF_INET, hints->ai_socktype, 0);
+    if (sock < 0) {
+        perror("portmap_lookup(socket)");
+        return 0;
+    }
 
-        /* set the source address if specified */
-        if (src_ip.sin_addr.s_addr) {
-            /* portmapper doesn't need a reserved port */
-            src_ip.sin_port = 0;
+    /* set the source address if specified */
+    if (src_ip.sin_addr.s_addr) {
+        /* portmapper doesn't need a reserved port */
+        src_ip.sin_port = 0;
 
-            if (bind(sock, (struct sockaddr *) &src_ip, sizeof(src_ip)) == -1) {
-                perror("create_rpc_client(bind)");
-                return NULL;
-            }
+        if (bind(sock, (struct sockaddr *) &src_ip, sizeof(src_ip)) == -1) {
+            perror("portmap_lookup(bind)");
+            close(sock);
+            return 0;
         }
+    }
 
-        if (connect(sock, (struct sockaddr *)client_sock, sizeof(struct sockaddr)) == 0) {
-            /* TCP */
-            if (hints->ai_socktype == SOCK_STREAM) {
-                protocol = PMAP_IPPROTO_TCP;
-                    client = clnttcp_create(client_sock, PMAPPROG, PMAPVERS, &sock, 0, 0);
-                    if (client == NULL) {
-                        clnt_pcreateerror("clnttcp_create");
-                    }
-            /* UDP */
-            } else {
-                protocol = PMAP_IPPROTO_UDP;
-                client = clntudp_create(client_sock, PMAPPROG, PMAPVERS, timeout, &sock);
+    if (connect(sock, (struct sockaddr *)&pmap_sock, sizeof(struct sockaddr)) == 0) {
+        /* TCP */
+        if (hints->ai_socktype == SOCK_STREAM) {
+            protocol = PMAP_IPPROTO_TCP;
+                client = clnttcp_create(&pmap_sock, PMAPPROG, PMAPVERS, &sock, 0, 0);
                 if (client == NULL) {
-                    clnt_pcreateerror("clntudp_create");
+                    clnt_pcreateerror("clnttcp_create");
                 }
-            }
+        /* UDP */
         } else {
-            perror("create_rpc_client(connect)");
-            return NULL;
+            protocol = PMAP_IPPROTO_UDP;
+            client = clntudp_create(&pmap_sock, PMAPPROG, PMAPVERS, timeout, &sock);
+            if (client == NULL) {
+                clnt_pcreateerror("clntudp_create");
+            }
         }
+    } else {
+        perror("portmap_lookup(connect)");
+        close(sock);
+        return 0;
+    }
 
-        if (verbose) {
-            if (getsockname(sock, (struct sockaddr *)&getaddr, &len) == -1) {
-                perror("create_rpc_client(getsockname)");
-                /* this is just verbose output so don't return an error */
-            } else {
-                inet_ntop(AF_INET, (struct sockaddr_in *)&getaddr.sin_addr, src, INET_ADDRSTRLEN);
-                //inet_ntop(AF_INET, &(((struct sockaddr_in *)&client_sock)->sin_addr), dst, INET_ADDRSTRLEN);
-                inet_ntop(AF_INET, &(client_sock->sin_addr), dst, INET_ADDRSTRLEN);
-                debug("portmap request = %s:%u -> %s:%u\n", src, ntohs(getaddr.sin_port), dst, ntohs(client_sock->sin_port));
-            }
+    inet_ntop(AF_INET, &(pmap_sock.sin_addr), dst, INET_ADDRSTRLEN);
+
+    if (verbose) {
+        if (getsockname(sock, (struct sockaddr *)&getaddr, &len) == -1) {
+            perror("portmap_lookup(getsockname)");
+            /* this is just verbose output so don't return an error */
+        } else {
+            inet_ntop(AF_INET, (struct sockaddr_in *)&getaddr.sin_addr, src, INET_ADDRSTRLEN);
+            debug("portmap request = %s:%u -> %s:%u\n", src, ntohs(getaddr.sin_port), dst, ntohs(pmap_sock.sin_port));
         }
+    }
 
-        /* query the portmapper */
-        client_sock->sin_port = get_rpc_port(client, prognum, version, protocol);
+    /* query the portmapper */
+    port = get_rpc_port(client, prognum, version, protocol);
 
+    if (client) {
+        /* have the socket closed along with the portmapper connection */
+        clnt_control(client, CLSET_FD_CLOSE, NULL);
         /* close the portmapper connection */
         client = destroy_rpc_client(client);
+    } else {
+        close(sock);
+    }
+
+    /* by this point we should know which port we're talking to */
+    debug("portmapper = %s:%u\n", dst, ntohs(port));
+
+    return port;
+}
+
 
-        /* by this point we should know which port we're talking to */
-        debug("portmapper = %s:%u\n", dst, ntohs(client_sock->sin_port));
+/* make a new socket bound to a reserved port (if we're allowed) and connect it to the server */
+/* takes an initialised sockaddr_in with the address and port */
+/* if client_sock is NULL the socket is left unconnected (for sendto) */
+/* returns the socket, or -1 on error */
+int create_rpc_socket(struct sockaddr_in *client_sock, int socktype, struct sockaddr_in src_ip) {
+    int sock;
+    char src[INET_ADDRSTRLEN];
+    char dst[INET_ADDRSTRLEN];
+    struct sockaddr_in getaddr; /* for getsockname */
+    socklen_t len = sizeof(getaddr);
+
+    /* Make sure and make new sockets for each new connection */
+    /* clnttcp_create will happily reuse open sockets */
+    sock = socket(AF_INET, socktype, 0);
+    if (sock < 0) {
+        perror("create_rpc_socket(socket)");
+        return -1;
+    }
+
+    /* always try and bind to a low port first */
+    /* could check for root here but there are other mechanisms for allowing processes to bind to low ports */
+    if (bindresvport(sock, &src_ip) == -1) {
+        /* permission denied, ie we aren't root */
+        if (errno == EACCES) {
+            /* try an ephemeral port */
+            src_ip.sin_port = htons(0);
+
+            /* still use the source address if one was specified */
+            if (src_ip.sin_addr.s_addr && bind(sock, (struct sockaddr *) &src_ip, sizeof(src_ip)) == -1) {
+                perror("create_rpc_socket(bind)");
+                close(sock);
+                return -1;
+            }
+        } else {
+            perror("create_rpc_socket(bindresvport)");
+            close(sock);
+            return -1;
+        }
+    }
+
+    /* unconnected socket */
+    if (client_sock == NULL) {
+        return sock;
+    }
+
+    /* now we're bound to a local socket, try and connect to the server */
+    if (connect(sock, (struct sockaddr *)client_sock, sizeof(struct sockaddr)) == -1) {
+        perror("create_rpc_socket(connect)");
+        close(sock);
+        return -1;
+    }
+
+    if (verbose) {
+        if (getsockname(sock, (struct sockaddr *)&getaddr, &len) == -1) {
+            perror("create_rpc_socket(getsockname)");
+            /* this is just verbose output so don't return an error */
+        } else {
+            inet_ntop(AF_INET, (struct sockaddr_in *)&getaddr.sin_addr, src, INET_ADDRSTRLEN);
+            inet_ntop(AF_INET, &(client_sock->sin_addr), dst, INET_ADDRSTRLEN);
+            debug("Connected = %s:%u -> %s:%u\n", src, ntohs(getaddr.sin_port), dst, ntohs(client_sock->sin_port));
+        }
+    }
+
+    return sock;
+}
+
+
+/* create an RPC client with the library's default buffer sizes */
+/* takes an initialised sockaddr_in with the address and port */
+/* returns an initialised client, or NULL on error */
+CLIENT *create_rpc_client(struct sockaddr_in *client_sock, struct addrinfo *hints, unsigned long prognum, unsigned long version, struct timeval timeout, struct sockaddr_in src_ip) {
+    return create_rpc_client_bufsize(client_sock, hints, prognum, version, timeout, src_ip, 0, 0);
+}
+
+
+/* create an RPC client with buffers for requests of sendsz bytes and responses of recvsz bytes */
+/* UDP responses that don't fit in the buffer are truncated, TCP clients read larger ones in pieces */
+/* 0 uses the default size */
+/* returns an initialised client, or NULL on error */
+CLIENT *create_rpc_client_bufsize(struct sockaddr_in *client_sock, struct addrinfo *hints, unsigned long prognum, unsigned long version, struct timeval timeout, struct sockaddr_in src_ip, u_int sendsz, u_int recvsz) {
+    CLIENT *client = NULL;
+    int sock;
+
+    /* check if we need to use the portmapper, 0 = yes */
+    if (client_sock->sin_port == 0) {
+        client_sock->sin_port = portmap_lookup(client_sock, hints, prognum, version, timeout, src_ip);
     }
 
     /* now make the client connection */
 
     /* by now we should have a port defined unless the program isn't registered */
     if (client_sock->sin_port) {
-        /* Make sure and make new sockets for each new connection */
-        /* clnttcp_create will happily reuse open sockets */
-        sock = socket(AF_INET, hints->ai_socktype, 0);
+        sock = create_rpc_socket(client_sock, hints->ai_socktype, src_ip);
         if (sock < 0) {
-            perror("create_rpc_client(socket)");
             return NULL;
         }
 
-        /* always try and bind to a low port first */
-        /* could check for root here but there are other mechanisms for allowing processes to bind to low ports */
-        if (bindresvport(sock, &src_ip) == -1) {
-            /* permission denied, ie we aren't root */
-            if (errno == EACCES) {
-                /* try an ephemeral port */
-                src_ip.sin_port = htons(0);
-            } else {
-                perror("create_rpc_client(bindresvport)");
-                return NULL;
-            }
-        }
-
-        /* now we're bound to a local socket, try and connect to the server */
-        if (connect(sock, (struct sockaddr *)client_sock, sizeof(struct sockaddr)) == 0) {
-            /* TCP */
-            if (hints->ai_socktype == SOCK_STREAM) {
-                    /* TODO set recvsz and sendsz to the NFS blocksize */
-                    client = clnttcp_create(client_sock, prognum, version, &sock, 0, 0);
-                    if (client == NULL) {
-                        clnt_pcreateerror("clnttcp_create");
-                    }
-            /* UDP */
-            } else {
-                client = clntudp_create(client_sock, prognum, version, timeout, &sock);
+        /* TCP */
+        if (hints->ai_socktype == SOCK_STREAM) {
+                client = clnttcp_create(client_sock, prognum, version, &sock, sendsz, recvsz);
                 if (client == NULL) {
-                    clnt_pcreateerror("clntudp_create");
+                    clnt_pcreateerror("clnttcp_create");
                 }
-            }
+        /* UDP */
         } else {
-            perror("create_rpc_client(connect)");
-            return NULL;
-        }
-
-        if (verbose) {
-            if (getsockname(sock, (struct sockaddr *)&getaddr, &len) == -1) {
-                perror("create_rpc_client(getsockname)");
-                /* this is just verbose output so don't return an error */
-            } else {
-                inet_ntop(AF_INET, (struct sockaddr_in *)&getaddr.sin_addr, src, INET_ADDRSTRLEN);
-                inet_ntop(AF_INET, &(client_sock->sin_addr), dst, INET_ADDRSTRLEN);
-                debug("Connected = %s:%u -> %s:%u\n", src, ntohs(getaddr.sin_port), dst, ntohs(client_sock->sin_port));
+            client = clntudp_bufcreate(client_sock, prognum, version, timeout, &sock, sendsz ? sendsz : UDPMSGSIZE, recvsz ? recvsz : UDPMSGSIZE);
+            if (client == NULL) {
+                clnt_pcreateerror("clntudp_bufcreate");
             }
         }
     }
@@ -2,6 +2,9 @@
 #define RPC_H
 
 CLIENT *create_rpc_client(struct sockaddr_in *client_sock, struct addrinfo *hints, unsigned long prognum, unsigned long version, struct timeval timeout, struct sockaddr_in src_ip);
+CLIENT *create_rpc_client_bufsize(struct sockaddr_in *client_sock, struct addrinfo *hints, unsigned long prognum, unsigned long version, struct timeval timeout, struct sockaddr_in src_ip, u_int sendsz, u_int recvsz);
+uint16_t portmap_lookup(struct sockaddr_in *client_sock, struct addrinfo *hints, unsigned long prognum, unsigned long version, struct timeval timeout, struct sockaddr_in src_ip);
+int create_rpc_socket(struct sockaddr_in *client_sock, int socktype, struct sockaddr_in src_ip);
 CLIENT *destroy_rpc_client(CLIENT *client);
 uint16_t get_rpc_port(CLIENT *client, long unsigned prognum, long unsigned version, long unsigned protocol);
 
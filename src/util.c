@@ -5,6 +5,28 @@
 /* globals */
 volatile sig_atomic_t quitting = 0;
 
+/* number of filehandle structs to allocate at once */
+#define FH_SLAB 256
+
+/* starting number of slots in the target index, always a power of 2 */
+#define TARGET_INDEX_MIN 1024
+
+/* hash index of IP addresses to targets so looking up a target doesn't have to scan the whole list */
+/* it follows the last list that was searched, and picks up anything appended to the list since the last search */
+/* targets are never removed from a list so that's all it has to do to stay up to date */
+static struct target_index {
+    targets_t *head;
+    /* the last target that's been indexed */
+    targets_t *tail;
+    /* open addressing with linear probing, a NULL target is an empty slot */
+    struct target_slot {
+        in_addr_t addr;
+        targets_t *target;
+    } *slots;
+    unsigned long size;
+    unsigned long count;
+} target_index;
+
 
 /* handle control-c */
 void sigint_handler(int sig) {
@@ -113,117 +135,505 @@ int nfs_perror(nfsstat3 status, const char *s) {
 }
 
 
+/* the string fields of a filehandle record */
+/* they point into the input line, or into parson's tree if the line had to be parsed by parson */
+struct fh_record {
+    const char *ip;
+    const char *host;
+    const char *path;
+    const char *filehandle;
+};
+
+
+/* find the end of a JSON string, input points to the opening quote */
+/* returns a pointer to the closing quote, or NULL if it's unterminated or has a \u escape that would need decoding */
+static char *scan_json_string(char *input) {
+    char *p = input + 1;
+
+    for (;;) {
+        p += strcspn(p, "\"\\");
+
+        if (*p == '"') {
+            return p;
+        }
+
+        /* a backslash, skip the escaped character */
+        if (*p == '\0' || p[1] == '\0' || p[1] == 'u') {
+            return NULL;
+        }
+
+        p += 2;
+    }
+}
+
+
+/* decode the simple escapes in a JSON string in place and terminate it */
+/* start is just after the opening quote and end is the closing quote */
+static char *unescape_json_string(char *start, char *end) {
+    char *r = start, *w = start;
+
+    while (r < end) {
+        if (*r == '\\') {
+            r++;
+            switch (*r) {
+                case 'b': *w = '\b'; break;
+                case 'f': *w = '\f'; break;
+                case 'n': *w = '\n'; break;
+                case 'r': *w = '\r'; break;
+                case 't': *w = '\t'; break;
+                /* quotes, slashes and backslashes */
+                default:  *w = *r;
+            }
+        } else {
+            *w = *r;
+        }
+        r++;
+        w++;
+    }
+
+    *w = '\0';
+
+    return start;
+}
+
+
+/* pick the fields out of a filehandle record without building a JSON tree */
+/* the tools all write a single flat object of strings and numbers on each line */
+/* returns -1 without changing the input for anything else, so it can be handed to parson instead */
+static int scan_fh_record(char *input, struct fh_record *record) {
+    /* the opening and closing quotes of each field's value */
+    char *fields[4][2] = { { NULL } };
+    char *p = input + strspn(input, " \t");
+    char *key, *key_end, *value, *value_end;
+    size_t key_len;
+    int i;
+
+    if (*p++ != '{') {
+        return -1;
+    }
+
+    for (;;) {
+        p += strspn(p, " \t");
+
+        if (*p == '}') {
+            break;
+        }
+
+        if (*p != '"' || (key_end = scan_json_string(p)) == NULL) {
+            return -1;
+        }
+        key = p + 1;
+        key_len = key_end - key;
+
+        p = key_end + 1;
+        p += strspn(p, " \t");
+        if (*p++ != ':') {
+            return -1;
+        }
+        p += strspn(p, " \t");
+
+        if (*p == '"') {
+            value = p;
+            value_end = scan_json_string(p);
+            if (value_end == NULL) {
+                return -1;
+            }
+            p = value_end + 1;
+
+            if (key_len == 2 && memcmp(key, "ip", 2) == 0) {
+                i = 0;
+            } else if (key_len == 4 && memcmp(key, "host", 4) == 0) {
+                i = 1;
+            } else if (key_len == 4 && memcmp(key, "path", 4) == 0) {
+                i = 2;
+            } else if (key_len == 10 && memcmp(key, "filehandle", 10) == 0) {
+                i = 3;
+            } else {
+                i = -1;
+            }
+
+            if (i >= 0) {
+                fields[i][0] = value;
+                fields[i][1] = value_end;
+            }
+        } else {
+            /* numbers, true, false and null, anything nested is left to parson */
+            value = p;
+            p += strcspn(p, ",}\n");
+            if (p == value || memchr(value, '{', p - value) || memchr(value, '[', p - value)) {
+                return -1;
+            }
+        }
+
+        p += strspn(p, " \t");
+        if (*p == ',') {
+            p++;
+        } else if (*p != '}') {
+            return -1;
+        }
+    }
+
+    /* the whole record is valid so it's safe to start changing the input */
+    record->ip         = fields[0][0] ? unescape_json_string(fields[0][0] + 1, fields[0][1]) : NULL;
+    record->host       = fields[1][0] ? unescape_json_string(fields[1][0] + 1, fields[1][1]) : NULL;
+    record->path       = fields[2][0] ? unescape_json_string(fields[2][0] + 1, fields[2][1]) : NULL;
+    record->filehandle = fields[3][0] ? unescape_json_string(fields[3][0] + 1, fields[3][1]) : NULL;
+
+    return 0;
+}
+
+
+/* the value of a hex digit, or -1 if it isn't one */
+static inline int hex_digit(unsigned char c) {
+    if ((unsigned int)(c - '0') < 10) {
+        return c - '0';
+    }
+
+    /* lower case the letters */
+    c |= 0x20;
+    if ((unsigned int)(c - 'a') < 6) {
+        return c - 'a' + 10;
+    }
+
+    return -1;
+}
+
+
+/* convert a hex string to bytes */
+/* returns the number of bytes, or -1 if it isn't an even number of hex digits that fits in a filehandle */
+static int string_to_fh_bytes(const char *hex, char *bytes) {
+    size_t len = strlen(hex);
+    size_t i;
+    int high, low;
+
+    if (len == 0 || len % 2 || len / 2 > FHSIZE3) {
+        return -1;
+    }
+
+    for (i = 0; i < len / 2; i++) {
+        high = hex_digit(hex[i * 2]);
+        low = hex_digit(hex[i * 2 + 1]);
+
+        if (high < 0 || low < 0) {
+            return -1;
+        }
+
+        bytes[i] = high << 4 | low;
+    }
+
+    return len / 2;
+}
+
+
+/* add a filehandle to the target with its IP address, making a new target if there isn't one */
+/* returns the target */
+static targets_t *add_fh(targets_t *head, struct sockaddr_in *sock, const char *host, const char *path, const char *bytes, int fh_len, uint16_t port, unsigned long count) {
+    targets_t *current;
+    struct nfs_fh_list *fh;
+
+    /* see if there's already a target for this IP, or make a new one */
+    current = find_or_make_target(head, sock, port, count);
+
+    /* TODO compare it to the IP address from JSON input and error if they don't match? */
+    /* every filehandle from the same server has the same name so only set it once */
+    if (current->display_name == NULL || strcmp(current->name, host)) {
+        strncpy(current->name, host, NI_MAXHOST - 1);
+
+        /* default to using the hostname */
+        current->display_name = current->name;
+
+        /* reverse the hostname */
+        current->ndqf = reverse_fqdn(current->name);
+    }
+
+    /* allocate a new filehandle struct */
+    fh = nfs_fh_list_new(current, count);
+
+    /* the slab is already zeroed, so don't pad the rest of the path like strncpy() */
+    memcpy(fh->path, path, strnlen(path, MNTPATHLEN - 1));
+
+    fh->nfs_fh.data.data_len = fh_len;
+    fh->nfs_fh.data.data_val = malloc(fh_len);
+    memcpy(fh->nfs_fh.data.data_val, bytes, fh_len);
+
+    return current;
+}
+
+
 /* break up a JSON filehandle into parts */
-/* this uses parson */
+/* the usual records are picked apart directly, anything unusual goes through parson */
 /* port should be in host byte order (ie 2049) */
-targets_t *parse_fh(targets_t *head, char *input, uint16_t port, struct timeval timeout, unsigned long count) {
-    unsigned int i;
-    const char *tmp;
-    u_int fh_len = 0;
-    JSON_Value  *root_value;
+targets_t *parse_fh(targets_t *head, char *input, uint16_t port, unsigned long count) {
+    char bytes[FHSIZE3];
+    int fh_len;
+    JSON_Value  *root_value = NULL;
     JSON_Object *filehandle;
+    struct fh_record record;
     targets_t *current = NULL;
-    targets_t *retval = NULL; /* return this */
-    struct nfs_fh_list *fh;
     struct sockaddr_in sock;
 
     /* sanity check */
-    if (strlen(input) == 0) {
+    if (input[0] == '\0') {
         fprintf(stderr, "No input!\n");
         return NULL;
     }
 
-    root_value = json_parse_string(input);
-    /* TODO if root isn't object, bail */
-    filehandle = json_value_get_object(root_value);
+    if (scan_fh_record(input, &record)) {
+        root_value = json_parse_string(input);
+        /* TODO if root isn't object, bail */
+        filehandle = json_value_get_object(root_value);
 
-    /* first find the IP address so we can find or create a new target */
-    tmp = json_object_get_string(filehandle, "ip");
+        record.ip         = json_object_get_string(filehandle, "ip");
+        record.host       = json_object_get_string(filehandle, "host");
+        record.path       = json_object_get_string(filehandle, "path");
+        record.filehandle = json_object_get_string(filehandle, "filehandle");
+    }
 
-    if (tmp) {
-        /* convert the IP string back into a network address */
-        if (inet_pton(AF_INET, tmp, &sock.sin_addr)) {
-            /* see if there's already a target for this IP, or make a new one */
-            current = find_or_make_target(head, &sock, port, timeout, count);
+    /* check everything before making a target so bad input doesn't leave an empty one behind */
+    if (record.ip == NULL) {
+        fprintf(stderr, "No ip found!\n");
+    /* convert the IP string back into a network address */
+    } else if (inet_pton(AF_INET, record.ip, &sock.sin_addr) != 1) {
+        fprintf(stderr, "Invalid IP address: %s\n", record.ip);
+    /* don't do any DNS resolution, so the hostname is used for display only */
+    /* TODO if there isn't a hostname, try and resolve it from the IP? */
+    } else if (record.host == NULL) {
+        fprintf(stderr, "No host found!\n");
+    /* path is just used for display */
+    } else if (record.path == NULL) {
+        fprintf(stderr, "No path found!\n");
+    /* the root filehandle in hex */
+    } else if (record.filehandle == NULL) {
+        fprintf(stderr, "No filehandle found!\n");
+    } else if ((fh_len = string_to_fh_bytes(record.filehandle, bytes)) < 0) {
+        fprintf(stderr, "Invalid filehandle: %s\n", record.filehandle);
+    } else {
+        current = add_fh(head, &sock, record.host, record.path, bytes, fh_len, port, count);
+    }
 
-            /* TODO reverse DNS lookup? */
+    /* the strings point into the tree so it can't be freed until they're copied */
+    if (root_value) {
+        json_value_free(root_value);
+    }
 
-            /* then find the hostname */
-            /* don't do any DNS resolution, so the hostname is used for display only */
-            tmp = json_object_get_string(filehandle, "host");
+    return current;
+}
 
-            /* TODO if there isn't a hostname, try and resolve it from the IP? */
-            /* TODO compare it to the IP address from JSON input and error if they don't match? */
 
-            if (tmp) {
-                /* TODO check length against NI_MAXHOST */
-                strncpy(current->name, tmp, NI_MAXHOST);
+/* read a big endian integer from a binary filehandle record */
+static inline unsigned int get_uint(const unsigned char *p, int bytes) {
+    unsigned int value = 0;
 
-                /* default to using the hostname */
-                current->display_name = current->name;
+    while (bytes--) {
+        value = value << 8 | *p++;
+    }
 
-                /* reverse the hostname */
-                current->ndqf = reverse_fqdn(current->name);
+    return value;
+}
 
-                /* path is just used for display */
-                tmp = json_object_get_string(filehandle, "path");
 
-                if (tmp) {
-                    /* allocate a new filehandle struct */
-                    fh = nfs_fh_list_new(current, count);
+/* decode a binary filehandle record, see print_fh_record() for the layout */
+/* record points just after the length, which is len */
+static targets_t *parse_fh_record(targets_t *head, const unsigned char *record, size_t len, uint16_t port, unsigned long count) {
+    const unsigned char *end = record + len;
+    char host[NI_MAXHOST];
+    char path[MNTPATHLEN];
+    const char *bytes;
+    struct sockaddr_in sock;
+    size_t host_len, path_len, fh_len;
 
-                    /* TODO check length aginst MNTPATHLEN */
-                    strncpy(fh->path, tmp, MNTPATHLEN);
+    if (len < 4 + 1) {
+        goto invalid;
+    }
+    memcpy(&sock.sin_addr, record, 4);
+    record += 4;
 
-                    /* the root filehandle in hex */
-                    tmp = json_object_get_string(filehandle, "filehandle");
+    host_len = *record++;
+    if (record + host_len + 2 > end) {
+        goto invalid;
+    }
+    memcpy(host, record, host_len);
+    host[host_len] = '\0';
+    record += host_len;
+
+    path_len = get_uint(record, 2);
+    record += 2;
+    if (path_len >= MNTPATHLEN || record + path_len + 1 > end) {
+        goto invalid;
+    }
+    memcpy(path, record, path_len);
+    path[path_len] = '\0';
+    record += path_len;
 
-                    if (tmp) {
-                        /* TODO break this out into a function string_to_nfs_fh3() */
+    fh_len = *record++;
+    if (fh_len == 0 || fh_len > FHSIZE3 || record + fh_len > end) {
+        goto invalid;
+    }
+    bytes = (const char *)record;
 
-                        /* hex takes two characters for each byte */
-                        fh_len = strlen(tmp) / 2;
+    return add_fh(head, &sock, host, path, bytes, fh_len, port, count);
 
-                        /* check that it's an even number */
-                        if (fh_len && fh_len <= FHSIZE3 && (strlen(tmp) % 2 == 0)) {
-                            fh->nfs_fh.data.data_len = fh_len;
-                            fh->nfs_fh.data.data_val = malloc(fh_len);
+invalid:
+    fprintf(stderr, "Invalid filehandle record!\n");
+    return NULL;
+}
 
-                            /* convert from the hex string to a byte array */
-                            for (i = 0; i <= fh->nfs_fh.data.data_len; i++) {
-                                sscanf(&tmp[i * 2], "%2hhx", &fh->nfs_fh.data.data_val[i]);
-                            }
 
-                            /* set the return value */
-                            retval = current;
-                        } else {
-                            fprintf(stderr, "Invalid filehandle: %s\n", tmp);
-                        }
-                    } else {
-                        fprintf(stderr, "No filehandle found!\n");
-                    }
-                } else {
-                    fprintf(stderr, "No path found!\n");
-                }
-            } else {
-                /* TODO reverse DNS lookup? */
-                fprintf(stderr, "No host found!\n");
+/* start reading filehandles from a stream */
+void fh_reader_init(struct fh_reader *reader, FILE *input) {
+    *reader = (struct fh_reader) { .input = input };
+}
+
+
+/* read the next filehandle from a stream of JSON lines or binary records and add it to the target list */
+/* binary streams start with FH_MAGIC, anything else is read as JSON */
+/* target is set to the filehandle's target, or NULL if it couldn't be parsed */
+/* returns -1 at the end of the input */
+int read_fh(struct fh_reader *reader, targets_t *head, uint16_t port, unsigned long count, targets_t **target) {
+    unsigned char record[FH_RECORD_MAX];
+    size_t len;
+    int c;
+
+    /* check for the binary header, JSON can't start with a NUL */
+    if (reader->started == 0) {
+        reader->started = 1;
+
+        c = getc(reader->input);
+        if (c == '\0') {
+            if (fread(record, 1, sizeof(FH_MAGIC) - 2, reader->input) != sizeof(FH_MAGIC) - 2
+                || memcmp(record, FH_MAGIC + 1, sizeof(FH_MAGIC) - 2)) {
+                fatalx(3, "Unknown filehandle input format!\n");
             }
-        } else {
-            fprintf(stderr, "Invalid IP address: %s\n", tmp);
+            reader->binary = 1;
+        } else if (c != EOF) {
+            ungetc(c, reader->input);
+        }
+    }
+
+    if (reader->binary) {
+        if (fread(record, 1, 2, reader->input) != 2) {
+            reader->finished = 1;
+            return -1;
+        }
+
+        len = get_uint(record, 2);
+        if (len > sizeof(record) || fread(record, 1, len, reader->input) != len) {
+            fprintf(stderr, "Truncated filehandle record!\n");
+            reader->finished = 1;
+            return -1;
         }
+
+        *target = parse_fh_record(head, record, len, port, count);
     } else {
-        fprintf(stderr, "No ip found!\n");
+        if (getline(&reader->line, &reader->line_len, reader->input) == -1) {
+            reader->finished = 1;
+            return -1;
+        }
+
+        *target = parse_fh(head, reader->line, port, count);
+    }
+
+    return 0;
+}
+
+
+/* step through one round of requests, a filehandle at a time */
+/* until the end of the input the round is the filehandles as they're read, so the first requests go out as soon as */
+/* the first filehandle arrives instead of waiting for the upstream program to finish */
+/* after that each round goes through every filehandle in the target list */
+/* pass the previous filehandle, or NULL to start a round */
+/* returns the next filehandle and sets target, or NULL at the end of the round */
+nfs_fh_list *next_fh(struct fh_reader *reader, targets_t *head, uint16_t port, unsigned long count, targets_t **target, nfs_fh_list *fh) {
+    targets_t *current;
+
+    if (reader->finished == 0) {
+        while (read_fh(reader, head, port, count, &current) != -1) {
+            /* skip anything that couldn't be parsed */
+            if (current) {
+                *target = current;
+                return current->last_filehandle;
+            }
+        }
+
+        return NULL;
+    }
+
+    if (fh && fh->next) {
+        return fh->next;
     }
 
-    /* cleanup if we allocated a result but failed to set a return value */
-    if (retval == NULL && current) {
-        /* TODO need a free_target() function! */
-        if (current->client_sock) free(current->client_sock);
-        free(current);
+    /* move on to the next target with filehandles, skipping the dummy entry at the head */
+    current = fh ? (*target)->next : head->next;
+    while (current && current->filehandles == NULL) {
+        current = current->next;
     }
 
-    return retval;
+    if (current) {
+        *target = current;
+        return current->filehandles;
+    }
+
+    return NULL;
+}
+
+
+/* print a filehandle as a binary record instead of JSON */
+/* the stream starts with FH_MAGIC and each record is big endian:
+ *   2 bytes   length of the rest of the record
+ *   4 bytes   IPv4 address
+ *   1 byte    host name length, then the name
+ *   2 bytes   path length, then the path
+ *   1 byte    filehandle length, then the filehandle
+ * file is appended to the path with a / if it isn't NULL
+ * only the fields the tools need to find the file are kept, the rest of the JSON fields are dropped
+ */
+void print_fh_record(const char *host, struct in_addr ip_address, const char *path, const char *file, const char *fh, unsigned int fh_len) {
+    static int started = 0;
+    unsigned char record[FH_RECORD_MAX];
+    size_t host_len = strnlen(host, UINT8_MAX);
+    size_t path_len = strlen(path);
+    size_t name_len = file ? strlen(file) : 0;
+    /* add a separator if the path doesn't end in one */
+    int slash = file && path_len && path[path_len - 1] != '/';
+    size_t len;
+    unsigned char *p = record + 2;
+
+    if (path_len + slash + name_len >= MNTPATHLEN) {
+        fprintf(stderr, "Path too long for %s:%s/%s\n", host, path, file);
+        return;
+    }
+
+    if (started == 0) {
+        started = 1;
+        fwrite(FH_MAGIC, 1, sizeof(FH_MAGIC) - 1, stdout);
+    }
+
+    memcpy(p, &ip_address, 4);
+    p += 4;
+
+    *p++ = host_len;
+    memcpy(p, host, host_len);
+    p += host_len;
+
+    *p++ = (path_len + slash + name_len) >> 8;
+    *p++ = (path_len + slash + name_len) & 0xff;
+    memcpy(p, path, path_len);
+    p += path_len;
+    if (slash) {
+        *p++ = '/';
+    }
+    memcpy(p, file, name_len);
+    p += name_len;
+
+    *p++ = fh_len;
+    memcpy(p, fh, fh_len);
+    p += fh_len;
+
+    len = p - record - 2;
+    record[0] = len >> 8;
+    record[1] = len & 0xff;
+
+    fwrite(record, 1, p - record, stdout);
 }
 
 
@@ -291,9 +701,9 @@ char* reverse_fqdn(char *fqdn) {
 
 /* allocate and initialise a target struct */
 /* port should be in host byte order (ie 2049) */
-targets_t *init_target(uint16_t port, struct timeval timeout, unsigned long count) {
+targets_t *init_target(uint16_t port, unsigned long count) {
     targets_t *target;
-    
+
     target = calloc(1, sizeof(targets_t));
     target->next = NULL;
 
@@ -301,18 +711,12 @@ targets_t *init_target(uint16_t port, struct timeval timeout, unsigned long coun
     target->min = ULONG_MAX;
 
     /* allocate space for printing out a summary of all ping times at the end */
+    /* otherwise nfsping allocates histograms for storing results once it knows which ones it needs */
     if (count) {
-        target->results = calloc(count, sizeof(unsigned long));
+        target->results = calloc(count, sizeof(*target->results));
         if (target->results == NULL) {
             fatalx(3, "Couldn't allocate memory for results!\n");
         }
-    /* otherwise use histograms for storing results */
-    } else {
-        /* initialise the histogram */
-        //hdr_init(1, INT64_C(tv2us(timeout)), 3, target->histogram);
-        hdr_init(1, tv2us(timeout), 3, &target->histogram);
-        /* TODO only if -Q intervals specified! */
-        hdr_init(1, tv2us(timeout), 3, &target->interval_histogram);
     }
 
     target->client_sock = calloc(1, sizeof(struct sockaddr_in));
@@ -362,7 +766,7 @@ struct mount_exports *init_export(struct targets *target, char *path, unsigned l
 /* return the number of targets created (possibly including duplicates) */
 /* Always store the ip address string in target->ip_address. */
 /* port should be in host byte order (ie 2049) */
-unsigned int make_target(targets_t *head, char *target_name, const struct addrinfo *hints, uint16_t port, int dns, int display_ips, int multiple, struct timeval timeout, char *path, unsigned long count) {
+unsigned int make_target(targets_t *head, char *target_name, const struct addrinfo *hints, uint16_t port, int dns, int display_ips, int multiple, char *path, unsigned long count) {
     unsigned int created = 0;
     targets_t *target = NULL;
     struct addrinfo *addr;
@@ -371,7 +775,7 @@ unsigned int make_target(targets_t *head, char *target_name, const struct addrin
 
     /* first try treating the hostname as an IP address */
     if (inet_pton(AF_INET, target_name, &sock.sin_addr)) {
-        target = find_or_make_target(head, &sock, port, timeout, count);
+        target = find_or_make_target(head, &sock, port, count);
         created++;
 
         if (path) {
@@ -404,7 +808,7 @@ unsigned int make_target(targets_t *head, char *target_name, const struct addrin
         if (getaddr == 0) { /* success! */
             /* loop through possibly multiple DNS responses */
             while (addr) {
-                target = find_or_make_target(head, (struct sockaddr_in *)addr->ai_addr, port, timeout, count);
+                target = find_or_make_target(head, (struct sockaddr_in *)addr->ai_addr, port, count);
                 created++;
 
                 if (path) {
@@ -472,11 +876,11 @@ targets_t *copy_target(targets_t *target, unsigned long count) {
     /* copy the results array */
     /* TODO do we really want to copy the results or just make an empty array of the same size? */
     if (count) {
-        new_target->results = calloc(count, sizeof(unsigned long));
+        new_target->results = calloc(count, sizeof(*new_target->results));
         if (new_target->results == NULL) {
             fatalx(3, "Couldn't allocate memory for results!\n");
         }
-        memcpy(new_target->results, target->results, count);
+        memcpy(new_target->results, target->results, count * sizeof(*new_target->results));
     }
 
     return new_target;
@@ -507,50 +911,130 @@ targets_t *append_target(targets_t **head, targets_t *new_target) {
 /* create a new empty filehandle struct at the end of the current filehandle list in a target */
 /* return a pointer to the newly added filehandle */
 nfs_fh_list *nfs_fh_list_new(targets_t *target, unsigned long count) {
-    /* head of the list */
-    nfs_fh_list *current = target->filehandles;
-    nfs_fh_list *new_fh = calloc(1, sizeof(struct nfs_fh_list));
+    /* filehandles are never freed so hand them out from slabs instead of allocating each one */
+    static nfs_fh_list *slab;
+    static unsigned int slab_free = 0;
+    nfs_fh_list *new_fh;
+
+    if (slab_free == 0) {
+        slab = calloc(FH_SLAB, sizeof(struct nfs_fh_list));
+        if (slab == NULL) {
+            fatalx(3, "Couldn't allocate memory for filehandles!\n");
+        }
+        slab_free = FH_SLAB;
+    }
+
+    new_fh = slab++;
+    slab_free--;
 
     /* set this so that the first comparison will always be smaller */
     new_fh->min = ULONG_MAX;
 
     /* allocate space for printing out a summary of all ping times at the end */
-    /* TODO only if fping output */
-    new_fh->results = calloc(count, sizeof(unsigned long));
-    if (new_fh->results == NULL) {
-        fatalx(3, "Couldn't allocate memory for results!\n");
-    }
-   
-    if (current) {
-        /* find the last fh in the list */
-        while (current->next) {
-            current = current->next;
+    if (count) {
+        new_fh->results = calloc(count, sizeof(unsigned long));
+        if (new_fh->results == NULL) {
+            fatalx(3, "Couldn't allocate memory for results!\n");
         }
-        /* append */
-        current->next = new_fh;
+    }
+
+    /* append */
+    if (target->filehandles) {
+        target->last_filehandle->next = new_fh;
     } else {
         target->filehandles = new_fh;
     }
+    target->last_filehandle = new_fh;
 
     return new_fh;
 }
 
 
+/* find an IP address's slot in the target index, either the one holding it or the empty one where it would go */
+static struct target_slot *index_slot(in_addr_t addr) {
+    /* Fibonacci hashing spreads out sequential addresses */
+    unsigned long i = ((uint32_t)addr * 0x9E3779B97F4A7C15ULL) >> 32;
+
+    for (i &= target_index.size - 1; target_index.slots[i].target; i = (i + 1) & (target_index.size - 1)) {
+        if (target_index.slots[i].addr == addr) {
+            break;
+        }
+    }
+
+    return &target_index.slots[i];
+}
+
+
+/* add a target to the index */
+/* only the first target with each address is indexed, the same one a scan of the list would find */
+static void index_target(targets_t *target) {
+    struct target_slot *old = target_index.slots;
+    struct target_slot *slot;
+    unsigned long old_size = target_index.size;
+    unsigned long i;
+
+    /* targets without an address can't be found */
+    if (target->client_sock == NULL) {
+        return;
+    }
+
+    /* keep the index at most half full so the probes stay short */
+    if ((target_index.count + 1) * 2 > target_index.size) {
+        target_index.size = old_size ? old_size * 2 : TARGET_INDEX_MIN;
+        target_index.slots = calloc(target_index.size, sizeof(struct target_slot));
+        if (target_index.slots == NULL) {
+            fatalx(3, "Couldn't allocate memory for target index!\n");
+        }
+
+        for (i = 0; i < old_size; i++) {
+            if (old[i].target) {
+                *index_slot(old[i].addr) = old[i];
+            }
+        }
+
+        free(old);
+    }
+
+    slot = index_slot(target->client_sock->sin_addr.s_addr);
+
+    if (slot->target == NULL) {
+        slot->addr = target->client_sock->sin_addr.s_addr;
+        slot->target = target;
+        target_index.count++;
+    }
+}
+
+
+/* bring the index up to date with a target list */
+static void index_targets(targets_t *head) {
+    targets_t *current;
+
+    /* start again for a different list, or a new empty list that's reusing the old one's head */
+    if (head != target_index.head || (head && head->next == NULL && target_index.tail != head)) {
+        free(target_index.slots);
+        target_index = (struct target_index) { .head = head };
+    }
+
+    current = target_index.tail ? target_index.tail->next : head;
+
+    while (current) {
+        index_target(current);
+        target_index.tail = current;
+        current = current->next;
+    }
+}
+
+
 /* take the head of a list of targets, search for a match by IP address */
 /* return NULL pointer if no match */
 targets_t *find_target_by_ip(targets_t *head, struct sockaddr_in *ip_address) {
-    struct targets *current = head;
+    index_targets(head);
 
-    while (current) {
-        /* compare the IP addresses */
-        if (current->client_sock && current->client_sock->sin_addr.s_addr == ip_address->sin_addr.s_addr) {
-            return current;
-        } else {
-            current = current->next;
-        }
+    if (target_index.size == 0) {
+        return NULL;
     }
 
-    return NULL;
+    return index_slot(ip_address->sin_addr.s_addr)->target;
 }
 
 
@@ -574,7 +1058,7 @@ targets_t *find_target_by_ip(targets_t *head, struct sockaddr_in *ip_address) {
     separate function to find target by IP in list
  */
 /* port should be in host byte order (ie 2049) */
-targets_t *find_or_make_target(targets_t *head, struct sockaddr_in *ip_address, uint16_t port, struct timeval timeout, unsigned long count) {
+targets_t *find_or_make_target(targets_t *head, struct sockaddr_in *ip_address, uint16_t port, unsigned long count) {
     targets_t *current;
     
     /* first look for a duplicate in the target list */
@@ -583,7 +1067,7 @@ targets_t *find_or_make_target(targets_t *head, struct sockaddr_in *ip_address,
     /* not found */
     if (current == NULL) {
         /* make a blank one */
-        current = init_target(port, timeout, count);
+        current = init_target(port, count);
 
         /* copy the IP address */
         /* TODO should this be another argument to init_target()? */
@@ -593,7 +1077,14 @@ targets_t *find_or_make_target(targets_t *head, struct sockaddr_in *ip_address,
         inet_ntop(AF_INET, &((struct sockaddr_in *)ip_address)->sin_addr, current->ip_address, INET_ADDRSTRLEN);
 
         /* add it to the end of the target list */
-        append_target(&head, current);
+        /* the index has just caught up with the list so it knows where the end is */
+        if (target_index.tail) {
+            target_index.tail->next = current;
+            index_target(current);
+            target_index.tail = current;
+        } else {
+            append_target(&head, current);
+        }
     }
 
     return current;
@@ -626,6 +1117,42 @@ void ms2ts(struct timespec *ts, unsigned long ms) {
 }
 
 
+/* convert microseconds to a timespec */
+void us2ts(struct timespec *ts, unsigned long us) {
+    ts->tv_sec = us / 1000000;
+    ts->tv_nsec = (us % 1000000) * 1000;
+}
+
+
+/* sleep until an absolute CLOCK_MONOTONIC deadline */
+/* sleeping against a fixed schedule means errors in each sleep don't add up */
+/* with spin, wake up that much early and busy-wait for the rest since waking up from a sleep can take a while */
+/* returns early if interrupted by a signal */
+void sleep_until(const struct timespec *deadline, const struct timespec *spin) {
+    struct timespec wake = *deadline;
+    struct timespec now;
+
+    if (spin) {
+        timespecsub(deadline, spin, &wake);
+    }
+
+    if (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL) == 0 && spin) {
+        do {
+            clock_gettime(CLOCK_MONOTONIC, &now);
+        } while (timespeccmp(&now, deadline, <));
+    }
+}
+
+
+/* convert a frequency in Hertz (which can be less than 1) to the time between events */
+void hz2ts(struct timespec *ts, double hertz) {
+    unsigned long long ns = 1000000000 / hertz + 0.5;
+
+    ts->tv_sec = ns / 1000000000;
+    ts->tv_nsec = ns % 1000000000;
+}
+
+
 /* convert a timespec to microseconds */
 unsigned long ts2us(const struct timespec ts) {
     return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
@@ -4,23 +4,48 @@
 #include "nfsping.h"
 #include "parson/parson.h"
 
+/* binary filehandle streams start with this, it can't be the start of a JSON line */
+#define FH_MAGIC "\0nfsfh1\n"
+/* the largest binary filehandle record: length, address, host, path and filehandle */
+#define FH_RECORD_MAX (2 + 4 + 1 + UINT8_MAX + 2 + MNTPATHLEN + 1 + FHSIZE3)
+
+/* reads filehandles from stdin for the tools that take them as input */
+struct fh_reader {
+    FILE *input;
+    /* set once the first byte has been checked for the binary header */
+    int started;
+    int binary;
+    /* set once the end of the input has been read */
+    int finished;
+    /* for getline() */
+    char *line;
+    size_t line_len;
+};
+
 void sigint_handler(int);
 int nfs_perror(nfsstat3, const char *);
-targets_t *parse_fh(targets_t *, char *, uint16_t, struct timeval, unsigned long);
+targets_t *parse_fh(targets_t *, char *, uint16_t, unsigned long);
+void fh_reader_init(struct fh_reader *, FILE *);
+int read_fh(struct fh_reader *, targets_t *, uint16_t, unsigned long, targets_t **);
+nfs_fh_list *next_fh(struct fh_reader *, targets_t *, uint16_t, unsigned long, targets_t **, nfs_fh_list *);
+void print_fh_record(const char *, struct in_addr, const char *, const char *, const char *, unsigned int);
 char *nfs_fh3_to_string(nfs_fh3);
 char* reverse_fqdn(char *);
 struct mount_exports *init_export(struct targets *, char *, unsigned long);
-unsigned int make_target(targets_t *, char *, const struct addrinfo *, uint16_t, int, int, int, struct timeval, char *, unsigned long);
-targets_t *init_target(uint16_t, struct timeval, unsigned long);
+unsigned int make_target(targets_t *, char *, const struct addrinfo *, uint16_t, int, int, int, char *, unsigned long);
+targets_t *init_target(uint16_t, unsigned long);
 targets_t *copy_target(targets_t *, unsigned long);
 targets_t *append_target(targets_t **, targets_t *);
 nfs_fh_list *nfs_fh_list_new(targets_t *, unsigned long);
 targets_t *find_target_by_ip(targets_t *, struct sockaddr_in *);
-targets_t *find_or_make_target(targets_t *, struct sockaddr_in *, uint16_t, struct timeval, unsigned long);
+targets_t *find_or_make_target(targets_t *, struct sockaddr_in *, uint16_t, unsigned long);
 unsigned long tv2us(struct timeval);
 unsigned long tv2ms(struct timeval);
 void ms2tv(struct timeval *, unsigned long);
 void ms2ts(struct timespec *, unsigned long);
+void us2ts(struct timespec *, unsigned long);
+void hz2ts(struct timespec *, double);
+void sleep_until(const struct timespec *, const struct timespec *);
 unsigned long ts2us(const struct timespec);
 unsigned long ts2ms(struct timespec);
 unsigned long long ts2ns(const struct timespec);
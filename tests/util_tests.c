@@ -43,11 +43,155 @@ static char *test_nfs_perror_toobig_low() {
     return 0;
 }
 
+static char *test_find_or_make_target() {
+    targets_t head = { 0 };
+    targets_t *first, *target;
+    struct sockaddr_in sock = { 0 };
+    unsigned long i, count = 0;
+
+    sock.sin_addr.s_addr = htonl(0x0a000001);
+    first = find_or_make_target(&head, &sock, 2049, 0);
+    mu_assert("error, target not made!", first && head.next == first);
+    mu_assert("error, wrong port!", ntohs(first->client_sock->sin_port) == 2049);
+
+    /* enough to make the index grow a few times */
+    for (i = 0; i < 5000; i++) {
+        sock.sin_addr.s_addr = htonl(0x0a000001 + i);
+        target = find_or_make_target(&head, &sock, 2049, 0);
+        mu_assert("error, wrong address!", target->client_sock->sin_addr.s_addr == sock.sin_addr.s_addr);
+    }
+
+    for (target = head.next; target; target = target->next) {
+        count++;
+    }
+    mu_assert("error, duplicate targets!", count == 5000);
+
+    sock.sin_addr.s_addr = htonl(0x0a000001);
+    mu_assert("error, first target not found!", find_target_by_ip(&head, &sock) == first);
+
+    sock.sin_addr.s_addr = htonl(0x0b000001);
+    mu_assert("error, found a missing target!", find_target_by_ip(&head, &sock) == NULL);
+    return 0;
+}
+
+static char *test_find_target_appended() {
+    targets_t head = { 0 };
+    targets_t *list = &head;
+    targets_t *target;
+    struct sockaddr_in sock = { 0 };
+
+    sock.sin_addr.s_addr = htonl(0x0a000001);
+    mu_assert("error, found a target in an empty list!", find_target_by_ip(&head, &sock) == NULL);
+
+    /* targets added to the list directly are still found */
+    target = init_target(2049, 0);
+    target->client_sock->sin_addr = sock.sin_addr;
+    append_target(&list, target);
+    mu_assert("error, appended target not found!", find_target_by_ip(&head, &sock) == target);
+
+    /* and a duplicate doesn't replace the first one */
+    append_target(&list, copy_target(target, 0));
+    mu_assert("error, duplicate found first!", find_target_by_ip(&head, &sock) == target);
+    mu_assert("error, duplicate made!", find_or_make_target(&head, &sock, 2049, 0) == target);
+    return 0;
+}
+
+static char *test_parse_fh() {
+    targets_t head = { 0 };
+    targets_t *target;
+    char line[] = "{\"host\":\"filer\",\"ip\":\"10.1.2.3\",\"path\":\"\\/vol\\/a \\\"b\\\"\",\"usec\":12,\"filehandle\":\"00fFa1\"}\n";
+    /* parson handles anything the fast path doesn't */
+    char nested[] = "{\"ip\":\"10.1.2.3\",\"host\":\"filer\",\"path\":\"\\u002fb\",\"filehandle\":\"02\",\"x\":[1]}\n";
+    char bad[] = "{\"ip\":\"10.1.2.4\",\"host\":\"filer\",\"path\":\"/c\",\"filehandle\":\"0\"}\n";
+
+    target = parse_fh(&head, line, 2049, 0);
+    mu_assert("error, filehandle not parsed!", target && head.next == target);
+    mu_assert("error, wrong host!", strcmp(target->name, "filer") == 0);
+    mu_assert("error, wrong path!", strcmp(target->filehandles->path, "/vol/a \"b\"") == 0);
+    mu_assert("error, wrong filehandle length!", target->filehandles->nfs_fh.data.data_len == 3);
+    mu_assert("error, wrong filehandle!", memcmp(target->filehandles->nfs_fh.data.data_val, "\x00\xff\xa1", 3) == 0);
+
+    mu_assert("error, nested record not parsed!", parse_fh(&head, nested, 2049, 0) == target);
+    mu_assert("error, wrong escaped path!", strcmp(target->filehandles->next->path, "/b") == 0);
+
+    mu_assert("error, odd length filehandle parsed!", parse_fh(&head, bad, 2049, 0) == NULL);
+    mu_assert("error, target made for a bad filehandle!", target->next == NULL);
+    return 0;
+}
+
+static char *test_read_fh() {
+    targets_t head = { 0 };
+    targets_t *target = NULL;
+    struct fh_reader reader;
+    /* magic, then one record for 10.0.0.1 host "h" path "/p" filehandle 0xab 0xcd */
+    char binary[] = FH_MAGIC "\0\x0d" "\x0a\x00\x00\x01" "\x01" "h" "\x00\x02" "/p" "\x02" "\xab\xcd";
+    char text[] = "{\"ip\":\"10.0.0.2\",\"host\":\"j\",\"path\":\"/q\",\"filehandle\":\"01\"}\n";
+    FILE *input;
+
+    input = fmemopen(binary, sizeof(binary) - 1, "r");
+    fh_reader_init(&reader, input);
+    mu_assert("error, binary record not read!", read_fh(&reader, &head, 2049, 0, &target) == 0 && target);
+    mu_assert("error, wrong address!", target->client_sock->sin_addr.s_addr == htonl(0x0a000001));
+    mu_assert("error, wrong host!", strcmp(target->name, "h") == 0);
+    mu_assert("error, wrong path!", strcmp(target->filehandles->path, "/p") == 0);
+    mu_assert("error, wrong filehandle!", target->filehandles->nfs_fh.data.data_len == 2 && memcmp(target->filehandles->nfs_fh.data.data_val, "\xab\xcd", 2) == 0);
+    mu_assert("error, no end of input!", read_fh(&reader, &head, 2049, 0, &target) == -1);
+    fclose(input);
+
+    input = fmemopen(text, strlen(text), "r");
+    fh_reader_init(&reader, input);
+    mu_assert("error, JSON not read!", read_fh(&reader, &head, 2049, 0, &target) == 0 && target);
+    mu_assert("error, wrong JSON host!", strcmp(target->name, "j") == 0);
+    mu_assert("error, no end of JSON input!", read_fh(&reader, &head, 2049, 0, &target) == -1);
+    fclose(input);
+    return 0;
+}
+
+static char *test_next_fh() {
+    targets_t head = { 0 };
+    targets_t *target = NULL;
+    nfs_fh_list *fh;
+    struct fh_reader reader;
+    char text[] =
+        "{\"ip\":\"10.0.0.1\",\"host\":\"a\",\"path\":\"/a\",\"filehandle\":\"01\"}\n"
+        "{\"ip\":\"10.0.0.2\",\"host\":\"b\",\"path\":\"/b\",\"filehandle\":\"02\"}\n"
+        "{\"ip\":\"10.0.0.1\",\"host\":\"a\",\"path\":\"/c\",\"filehandle\":\"03\"}\n";
+    FILE *input = fmemopen(text, strlen(text), "r");
+
+    fh_reader_init(&reader, input);
+
+    /* the first round is in the order the filehandles were read */
+    fh = next_fh(&reader, &head, 2049, 0, &target, NULL);
+    mu_assert("error, first filehandle not read!", fh && strcmp(fh->path, "/a") == 0);
+    fh = next_fh(&reader, &head, 2049, 0, &target, fh);
+    mu_assert("error, second filehandle not read!", fh && strcmp(fh->path, "/b") == 0 && strcmp(target->name, "b") == 0);
+    fh = next_fh(&reader, &head, 2049, 0, &target, fh);
+    mu_assert("error, third filehandle not read!", fh && strcmp(fh->path, "/c") == 0 && strcmp(target->name, "a") == 0);
+    mu_assert("error, first round didn't end!", next_fh(&reader, &head, 2049, 0, &target, fh) == NULL);
+
+    /* later rounds go through the list by target */
+    fh = next_fh(&reader, &head, 2049, 0, &target, NULL);
+    mu_assert("error, second round didn't start at the head!", fh && strcmp(fh->path, "/a") == 0);
+    fh = next_fh(&reader, &head, 2049, 0, &target, fh);
+    mu_assert("error, second round skipped a filehandle!", fh && strcmp(fh->path, "/c") == 0);
+    fh = next_fh(&reader, &head, 2049, 0, &target, fh);
+    mu_assert("error, second round skipped a target!", fh && strcmp(fh->path, "/b") == 0 && strcmp(target->name, "b") == 0);
+    mu_assert("error, second round didn't end!", next_fh(&reader, &head, 2049, 0, &target, fh) == NULL);
+
+    fclose(input);
+    return 0;
+}
+
 static char *all_tests() {
     mu_run_test(test_reverse_fqdn);
     mu_run_test(test_nfs_perror_nfs3ok);
     mu_run_test(test_nfs_perror_toobig);
     mu_run_test(test_nfs_perror_toobig_low);
+    mu_run_test(test_find_or_make_target);
+    mu_run_test(test_find_target_appended);
+    mu_run_test(test_parse_fh);
+    mu_run_test(test_read_fh);
+    mu_run_test(test_next_fh);
     return 0;
 }
 